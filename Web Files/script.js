@@ -2,7 +2,23 @@
 let ws;
 let reconnectInterval = 5000; // Reconnect every 5 seconds if connection fails
 let ecgChart;
-let ecgData = Array(100).fill(0); // Store 100 ECG data points for display
+const ECG_DISPLAY_POINTS = 500; // ~1.4 seconds at 360 Hz
+let ecgData = Array(ECG_DISPLAY_POINTS).fill(0); // ECG data points for display
+let nextSequence = null; // Expected sequence number of the next ECG frame
+
+// ECG channel (patient) shown on this page, selected with ?channel=N
+const selectedChannel = parseInt(new URLSearchParams(window.location.search).get('channel'), 10) || 0;
+
+// Stream tier requested from the server with ?view=raw|minmax|vitals
+const STREAM_TIERS = ['raw', 'minmax', 'vitals'];
+const requestedTier = new URLSearchParams(window.location.search).get('view');
+const streamTier = STREAM_TIERS.includes(requestedTier) ? requestedTier : 'raw';
+
+// Binary ECG frame layout (little-endian), see StreamFrameHeader in main.cpp
+const STREAM_FRAME_ECG = 0x01;
+const STREAM_FRAME_MINMAX = 0x02;
+const STREAM_HEADER_SIZE = 16;
+const ADC_TO_VOLTS = 3.3 / 4095.0;
 
 // Initialize WebSocket connection
 function initWebSocket() {
@@ -10,15 +26,25 @@ function initWebSocket() {
     const wsUrl = `${wsProtocol}//${window.location.host}/ws`;
     
     ws = new WebSocket(wsUrl);
+    ws.binaryType = 'arraybuffer';
     
     ws.onopen = function() {
         console.log('WebSocket connection established');
         document.getElementById('status').textContent = 'Connected';
         document.getElementById('status').style.color = '#27ae60';
+        
+        // New connections start with the raw stream
+        if (streamTier !== 'raw') {
+            ws.send(JSON.stringify({subscribe: streamTier}));
+        }
     };
     
     ws.onmessage = function(event) {
-        handleWebSocketMessage(event.data);
+        if (event.data instanceof ArrayBuffer) {
+            handleBinaryMessage(event.data);
+        } else {
+            handleWebSocketMessage(event.data);
+        }
     };
     
     ws.onclose = function() {
@@ -35,17 +61,72 @@ function initWebSocket() {
     };
 }
 
+// Handle incoming binary frames (batched ECG samples)
+function handleBinaryMessage(buffer) {
+    if (buffer.byteLength < STREAM_HEADER_SIZE) {
+        return;
+    }
+    
+    const view = new DataView(buffer);
+    const type = view.getUint8(0);
+    if (type !== STREAM_FRAME_ECG && type !== STREAM_FRAME_MINMAX) {
+        console.log('Unknown frame type:', type);
+        return;
+    }
+    
+    // Every channel streams over the same socket
+    if (view.getUint8(12) !== selectedChannel) {
+        return;
+    }
+    
+    // The server decimates frames for clients that fall behind
+    const decimation = view.getUint8(1) || 1;
+    const count = view.getUint16(2, true);
+    const sequence = view.getUint32(4, true);
+    const span = view.getUint16(14, true); // Samples the frame covers
+    if (nextSequence !== null && sequence !== nextSequence) {
+        console.log(`ECG stream gap: ${(sequence - nextSequence) >>> 0} samples missed`);
+    }
+    
+    if (type === STREAM_FRAME_MINMAX) {
+        // Each min, max pair covers one bucket: draw the min over its first
+        // half and the max over the second so peaks keep their height. The
+        // last bucket of a frame cut short covers only the rest of the span.
+        const buckets = count >> 1;
+        nextSequence = (sequence + span) >>> 0;
+        const values = new Array(span);
+        for (let i = 0; i < buckets; i++) {
+            const low = view.getInt16(STREAM_HEADER_SIZE + i * 4, true) * ADC_TO_VOLTS;
+            const high = view.getInt16(STREAM_HEADER_SIZE + i * 4 + 2, true) * ADC_TO_VOLTS;
+            const start = i * decimation;
+            const end = Math.min(start + decimation, span);
+            values.fill(low, start, start + ((end - start) >> 1));
+            values.fill(high, start + ((end - start) >> 1), end);
+        }
+        updateECGData(values);
+        return;
+    }
+    nextSequence = (sequence + span) >>> 0;
+    
+    // Repeat decimated samples so the chart keeps its time scale; the last
+    // one covers only what is left of the span
+    const values = new Array(span);
+    for (let i = 0; i < count; i++) {
+        const value = view.getInt16(STREAM_HEADER_SIZE + i * 2, true) * ADC_TO_VOLTS;
+        values.fill(value, i * decimation, Math.min((i + 1) * decimation, span));
+    }
+    updateECGData(values);
+}
+
 // Handle incoming WebSocket messages
 function handleWebSocketMessage(message) {
     try {
         const data = JSON.parse(message);
+        if (data.channel !== undefined && data.channel !== selectedChannel) {
+            return;
+        }
         
         switch(data.type) {
-            case 'ecg':
-                // Update ECG data and chart
-                updateECGData(data.value);
-                break;
-                
             case 'calories':
                 // Update calories and heart rate display
                 document.getElementById('calories').textContent = `${data.value.toFixed(1)} kcal`;
@@ -57,9 +138,21 @@ function handleWebSocketMessage(message) {
                 handleAnomaly(data.timestamp);
                 break;
                 
+            case 'vitals':
+                // Once a second, whatever the stream tier
+                if (!data.leadsOff) {
+                    document.getElementById('heart-rate').textContent = `${data.heartRate.toFixed(0)} BPM`;
+                    document.getElementById('hrv').textContent = data.rmssd > 0 ? `${data.rmssd.toFixed(0)} ms` : '-- ms';
+                }
+                break;
+                
+            case 'calibration':
+                addLogEntry(calibrationMessage(data), data.status === 'rejected');
+                break;
+                
             case 'alert':
-                // Display alert message
-                addLogEntry(data.message, true);
+                // Display alert message, reattached leads are not an anomaly
+                addLogEntry(data.message, data.leadsOff !== false);
                 break;
                 
             default:
@@ -71,10 +164,10 @@ function handleWebSocketMessage(message) {
 }
 
 // Update ECG data and chart
-function updateECGData(value) {
-    // Add new value to the end and remove oldest value
-    ecgData.push(value);
-    ecgData.shift();
+function updateECGData(values) {
+    // Add new values to the end and remove the oldest ones
+    ecgData.push(...values);
+    ecgData.splice(0, ecgData.length - ECG_DISPLAY_POINTS);
     
     // Update chart
     ecgChart.update();
@@ -99,6 +192,20 @@ function handleAnomaly(timestamp) {
     }, 5000);
 }
 
+// Describe a calibration status message for the log
+function calibrationMessage(data) {
+    switch(data.status) {
+        case 'started':
+            return `Calibrating: keep the patient at rest for ${data.beats} beats`;
+        case 'done':
+            return `Calibration done, ${(data.anomalous * 100).toFixed(0)}% of beats were flagged before`;
+        case 'rejected':
+            return `Calibration rejected: ${(data.anomalous * 100).toFixed(0)}% of beats look anomalous`;
+        default:
+            return 'Calibration cleared';
+    }
+}
+
 // Add entry to anomaly log
 function addLogEntry(message, isAnomaly = false) {
     const logContainer = document.getElementById('anomaly-log');
@@ -131,7 +238,7 @@ function initECGChart() {
     ecgChart = new Chart(ctx, {
         type: 'line',
         data: {
-            labels: Array(100).fill(''),  // Empty labels
+            labels: Array(ECG_DISPLAY_POINTS).fill(''),  // Empty labels
             datasets: [{
                 label: 'ECG Signal',
                 data: ecgData,
@@ -0,0 +1,970 @@
+/******************************************************************
+ * Host-side benchmark and replay harness for lib/ecg_core
+ *
+ * Replays ECG data through the same filter / QRS / segmenter / SVM code
+ * the firmware runs and reports latency percentiles, throughput, heap
+ * allocations on the hot path and detection accuracy against labels.
+ *
+ * Inputs:
+ *   --beats FILE         ECG5000-style CSV: 140 samples + label per row
+ *   --record FILE        continuous 360Hz CSV (e.g. MIT-BIH exports)
+ *     --column N         column holding the signal (default 1, MLII)
+ *     --gain G           ADC codes per input unit (default 0.62: MIT-BIH
+ *                        200 adu/mV through the AD8232's 100x gain)
+ *     --baseline B       input value mapped to ADC mid-scale (default 1024)
+ *     --annotations FILE beat annotations: "time sample type ..." as in the
+ *                        MIT-BIH text exports, or "sample,type"
+ *   --synthetic SECONDS  generated ECG with known beat positions (default)
+ *   --normal-label L     label of normal beats in --beats (default 1)
+ *   --model FILE         binary model file (svm-extraction.py --binary) to
+ *                        use instead of the compiled-in float model
+ ******************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ecg_config.h"
+#include "ecg_filters.h"
+#include "qrs_detector.h"
+#include "beat_segmenter.h"
+#include "svm_engine.h"
+#include "sliding_detector.h"
+#include "record_codec.h"
+#include "hrv_stats.h"
+#include "threshold_calibrator.h"
+#include "model_format.h"
+#include "svm_model_params.h"
+
+#if __has_include("svm_model_quantized.h")
+#include "svm_model_quantized.h"
+#define BENCH_HAS_QUANTIZED 1
+#else
+#define BENCH_HAS_QUANTIZED 0
+#endif
+
+#if __has_include("svm_model_rff.h")
+#include "svm_model_rff.h"
+#define BENCH_HAS_RFF 1
+#else
+#define BENCH_HAS_RFF 0
+#endif
+
+// Heap accounting: every allocation in the process goes through here
+static std::atomic<uint64_t> allocationCount{0};
+static std::atomic<uint64_t> allocationBytes{0};
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+// GCC pairs the inlined malloc above with these frees and warns spuriously
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+// Models, as main.cpp builds them
+const int MODEL_MAX_SUPPORT_VECTORS = SVM_NUM_SUPPORT_VECTORS > 256 ? SVM_NUM_SUPPORT_VECTORS : 256;
+typedef SVMModel<MODEL_MAX_SUPPORT_VECTORS, SVM_NUM_FEATURES> FloatModel;
+constexpr FloatModel svmModel = {
+    SVM_NUM_SUPPORT_VECTORS, SVM_GAMMA, SVM_BIAS, supportVectors, svmCoefficients, featureMeans, featureInverseStds,
+    supportVectorSqNorms, svmRemainingPositive, svmRemainingNegative,
+    SVM_PREFILTER ? svmPrefilterWeights : nullptr, SVM_PREFILTER_BIAS, SVM_PREFILTER_THRESHOLD
+};
+
+#if BENCH_HAS_QUANTIZED
+typedef QuantizedSVMModel<svm_quantized_t, SVM_NUM_SUPPORT_VECTORS, SVM_NUM_FEATURES> QuantizedModel;
+constexpr QuantizedModel quantizedSvmModel = {
+    SVM_Q_KERNEL_SCALE, SVM_Q_BIAS, SVM_Q_DECISION_UNIT, SVM_Q_MAX, SVM_Q_PRODUCT_SHIFT, SVM_EXP_LUT_SIZE, SVM_EXP_LUT_RESOLUTION,
+    quantSupportVectors, quantCoefficients, quantFeatureWeights, quantInputScales, svmExpLut,
+    featureMeans, featureInverseStds
+};
+#endif
+
+#if BENCH_HAS_RFF
+typedef RffModel<SVM_RFF_COMPONENTS, SVM_NUM_FEATURES> FourierModel;
+constexpr FourierModel rffModel = {
+    SVM_RFF_BIAS, rffProjection, rffPhases, rffWeights, featureMeans, featureInverseStds
+};
+#endif
+
+// The float model under test: svmModel, or one loaded with --model
+const FloatModel* floatModel = &svmModel;
+FloatModel loadedModel;
+float loadedRemainingPositive[MODEL_MAX_SUPPORT_VECTORS + 1];
+float loadedRemainingNegative[MODEL_MAX_SUPPORT_VECTORS + 1];
+float loadedInverseStds[SVM_NUM_FEATURES];
+std::vector<uint64_t> loadedModelFile;  // 8-byte elements keep the file 16-byte aligned on common hosts
+
+typedef std::chrono::steady_clock Clock;
+
+struct Annotation {
+    uint32_t sample;
+    bool normal;
+};
+
+struct LatencyStats {
+    std::vector<double> samples;  // Microseconds, reserved before measuring
+
+    void reserve(size_t count) { samples.reserve(count); }
+    void add(Clock::time_point start, Clock::time_point end) {
+        samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    void print(const char* name) {
+        if (samples.empty()) {
+            printf("  %-22s no samples\n", name);
+            return;
+        }
+        std::vector<double> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&](double p) {
+            size_t index = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+            return sorted[index];
+        };
+        double total = 0.0;
+        for (double value : sorted) {
+            total += value;
+        }
+        printf("  %-22s n=%-8zu mean=%8.2fus p50=%8.2fus p90=%8.2fus p99=%8.2fus p99.9=%8.2fus max=%8.2fus\n",
+               name, sorted.size(), total / sorted.size(), percentile(50), percentile(90), percentile(99),
+               percentile(99.9), sorted.back());
+    }
+};
+
+struct ConfusionMatrix {
+    uint64_t truePositive = 0;   // Anomalous beat flagged
+    uint64_t falsePositive = 0;
+    uint64_t trueNegative = 0;
+    uint64_t falseNegative = 0;
+
+    void add(bool predictedAnomaly, bool actualAnomaly) {
+        if (predictedAnomaly) {
+            actualAnomaly ? truePositive++ : falsePositive++;
+        } else {
+            actualAnomaly ? falseNegative++ : trueNegative++;
+        }
+    }
+
+    void print(const char* name) const {
+        uint64_t total = truePositive + falsePositive + trueNegative + falseNegative;
+        if (total == 0) {
+            printf("  %-22s no labelled beats\n", name);
+            return;
+        }
+        double sensitivity = truePositive + falseNegative ? (double)truePositive / (truePositive + falseNegative) : 0.0;
+        double specificity = trueNegative + falsePositive ? (double)trueNegative / (trueNegative + falsePositive) : 0.0;
+        printf("  %-22s accuracy=%.4f sensitivity=%.4f specificity=%.4f (TP=%llu FP=%llu TN=%llu FN=%llu)\n",
+               name, (double)(truePositive + trueNegative) / total, sensitivity, specificity,
+               (unsigned long long)truePositive, (unsigned long long)falsePositive,
+               (unsigned long long)trueNegative, (unsigned long long)falseNegative);
+    }
+};
+
+struct AllocationScope {
+    uint64_t startCount = allocationCount.load();
+    uint64_t startBytes = allocationBytes.load();
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+
+    // Call at the end of the measured loop, before reporting allocates anything
+    void stop() {
+        count = allocationCount.load() - startCount;
+        bytes = allocationBytes.load() - startBytes;
+    }
+
+    void print() const {
+        printf("  heap allocations       %llu (%llu bytes) on the measured path\n",
+               (unsigned long long)count, (unsigned long long)bytes);
+    }
+};
+
+static bool loadModelFile(const char* path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    size_t size = file.tellg();
+    loadedModelFile.assign((size + 15) / 8 + 2, 0);
+    // Start at a 16-byte boundary inside the buffer
+    uint8_t* data = (uint8_t*)loadedModelFile.data();
+    data += (16 - (uintptr_t)data % 16) % 16;
+    file.seekg(0);
+    file.read((char*)data, size);
+
+    ModelFileView view;
+    const char* error = nullptr;
+    if (!parseModelFile(data, size, SVM_NUM_FEATURES, MODEL_MAX_SUPPORT_VECTORS, view, error)) {
+        fprintf(stderr, "Invalid model file %s: %s\n", path, error);
+        return false;
+    }
+    int numSupportVectors = (int)view.header->numSupportVectors;
+    computeCascadeBounds(view.dualCoefficients, numSupportVectors, loadedRemainingPositive, loadedRemainingNegative);
+    computeInverseStds(view.featureStds, SVM_NUM_FEATURES, loadedInverseStds);
+    loadedModel = {numSupportVectors, view.header->gamma, view.header->bias,
+                   view.supportVectors, view.dualCoefficients, view.featureMeans, loadedInverseStds,
+                   view.supportVectorSqNorms, loadedRemainingPositive, loadedRemainingNegative,
+                   view.prefilter != nullptr ? view.prefilter + 4 : nullptr,
+                   view.prefilter != nullptr ? view.prefilter[0] : 0.0f,
+                   view.prefilter != nullptr ? view.prefilter[1] : 0.0f};
+    floatModel = &loadedModel;
+    printf("Loaded model %u from %s\n", (unsigned)view.header->modelId, path);
+    return true;
+}
+
+static std::vector<std::string> splitFields(const std::string& line) {
+    std::vector<std::string> fields;
+    std::string field;
+    std::stringstream stream(line);
+    while (std::getline(stream, field, ',')) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+static bool parseNumber(const std::string& text, double& value) {
+    const char* begin = text.c_str();
+    while (*begin == ' ' || *begin == '\'' || *begin == '"') {
+        begin++;
+    }
+    char* end = nullptr;
+    value = strtod(begin, &end);
+    return end != begin;
+}
+
+// MIT-BIH beat codes: N, L, R, e, j are normal; other beat codes are not;
+// rhythm, noise and artefact markers are not beats at all
+static bool isBeatAnnotation(const std::string& type) {
+    static const char* BEAT_CODES = "NLRejAaJSVEFP/fQ";
+    return type.size() == 1 && strchr(BEAT_CODES, type[0]) != nullptr;
+}
+
+static bool isNormalBeat(const std::string& type) {
+    return type == "N" || type == "L" || type == "R" || type == "e" || type == "j";
+}
+
+static std::vector<Annotation> loadAnnotations(const char* path) {
+    std::vector<Annotation> annotations;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::stringstream stream(line);
+        std::vector<std::string> tokens;
+        std::string token;
+        while (stream >> token) {
+            tokens.push_back(token);
+        }
+        // "time sample type ..." or "sample type"
+        size_t sampleField = !tokens.empty() && tokens[0].find(':') != std::string::npos ? 1 : 0;
+        if (tokens.size() < sampleField + 2) {
+            continue;
+        }
+        double sample;
+        if (!parseNumber(tokens[sampleField], sample) || !isBeatAnnotation(tokens[sampleField + 1])) {
+            continue;
+        }
+        annotations.push_back({(uint32_t)sample, isNormalBeat(tokens[sampleField + 1])});
+    }
+    return annotations;
+}
+
+static std::vector<uint16_t> loadRecord(const char* path, int column, double gain, double baseline) {
+    std::vector<uint16_t> samples;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields = splitFields(line);
+        double value;
+        if ((int)fields.size() <= column || !parseNumber(fields[column], value)) {
+            continue;  // Header or malformed line
+        }
+        double code = 2048.0 + (value - baseline) * gain;
+        samples.push_back((uint16_t)std::min(4095.0, std::max(0.0, std::round(code))));
+    }
+    return samples;
+}
+
+static std::vector<uint16_t> synthesizeRecord(double seconds, std::vector<Annotation>& annotations) {
+    // 60-90bpm with breathing-rate RR variation, baseline wander, 50Hz mains
+    // pickup and broadband noise, in ADC codes
+    size_t count = (size_t)(seconds * SAMPLING_RATE);
+    std::vector<double> signal(count, 0.0);
+    uint32_t noiseState = 12345;
+    double beatTime = 0.5;
+    int beat = 0;
+    while (beatTime < seconds) {
+        double rr = 0.8 + 0.12 * sin(beat * 0.4);
+        int peak = (int)std::lround(beatTime * SAMPLING_RATE);
+        annotations.push_back({(uint32_t)peak, true});
+        for (int n = std::max(0, peak - 100); n < std::min((int)count, peak + 200); n++) {
+            double t = (double)(n - peak) / SAMPLING_RATE;
+            signal[n] += 1.0 * exp(-pow(t / 0.012, 2))             // R
+                       - 0.15 * exp(-pow((t + 0.03) / 0.01, 2))    // Q
+                       - 0.2 * exp(-pow((t - 0.03) / 0.012, 2))    // S
+                       + 0.25 * exp(-pow((t - 0.25) / 0.05, 2))    // T
+                       + 0.1 * exp(-pow((t + 0.18) / 0.03, 2));    // P
+        }
+        beatTime += rr;
+        beat++;
+    }
+
+    std::vector<uint16_t> samples(count);
+    for (size_t n = 0; n < count; n++) {
+        double t = (double)n / SAMPLING_RATE;
+        noiseState = noiseState * 1664525u + 1013904223u;
+        double noise = ((noiseState >> 8) / 16777216.0 - 0.5) * 0.02;
+        double volts = 1.65 + 0.8 * signal[n] + 0.1 * sin(2 * M_PI * 0.3 * t) +
+                       0.03 * sin(2 * M_PI * 50.0 * t) + noise;
+        samples[n] = (uint16_t)std::min(4095.0, std::max(0.0, std::round(volts / ADC_TO_VOLTS)));
+    }
+    return samples;
+}
+
+// Returns the predictions, so approximate engines can be compared with the float one
+template <typename Model>
+static std::vector<bool> benchmarkBeats(const char* name, const Model& model,
+                                        const std::vector<std::vector<float>>& beats,
+                                        const std::vector<bool>& anomalous) {
+    LatencyStats latency;
+    latency.reserve(beats.size());
+    std::vector<bool> predictions(beats.size());
+    ConfusionMatrix confusion;
+    alignas(16) float standardized[ECG_BUFFER_SIZE];
+
+    AllocationScope allocations;
+    Clock::time_point begin = Clock::now();
+    for (size_t i = 0; i < beats.size(); i++) {
+        Clock::time_point start = Clock::now();
+        for (int j = 0; j < ECG_BUFFER_SIZE; j++) {
+            standardized[j] = model.standardize(beats[i][j], j);
+        }
+        bool predicted = model.isAnomalous(standardized);
+        Clock::time_point end = Clock::now();
+        latency.add(start, end);
+        confusion.add(predicted, anomalous[i]);
+        predictions[i] = predicted;
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    allocations.stop();
+
+    printf("%s engine\n", name);
+    latency.print("window latency");
+    printf("  throughput             %.0f windows/s\n", beats.size() / elapsed);
+    allocations.print();
+    confusion.print("classification");
+    return predictions;
+}
+
+// Same windows classified BENCH_BATCH_SIZE at a time, as for four channels
+// of the firmware; latency is per batch
+const int BENCH_BATCH_SIZE = 4;
+
+template <typename Model>
+static std::vector<bool> benchmarkBatches(const char* name, const Model& model,
+                                          const std::vector<std::vector<float>>& beats,
+                                          const std::vector<bool>& anomalous) {
+    LatencyStats latency;
+    latency.reserve(beats.size() / BENCH_BATCH_SIZE + 1);
+    std::vector<bool> predictions(beats.size());
+    ConfusionMatrix confusion;
+    alignas(16) float standardized[BENCH_BATCH_SIZE][ECG_BUFFER_SIZE];
+    const float* windows[BENCH_BATCH_SIZE];
+    bool predicted[BENCH_BATCH_SIZE];
+
+    AllocationScope allocations;
+    Clock::time_point begin = Clock::now();
+    for (size_t first = 0; first < beats.size(); first += BENCH_BATCH_SIZE) {
+        int count = (int)std::min<size_t>(BENCH_BATCH_SIZE, beats.size() - first);
+        Clock::time_point start = Clock::now();
+        for (int b = 0; b < count; b++) {
+            for (int j = 0; j < ECG_BUFFER_SIZE; j++) {
+                standardized[b][j] = model.standardize(beats[first + b][j], j);
+            }
+            windows[b] = standardized[b];
+        }
+        model.isAnomalousBatch(windows, count, predicted);
+        Clock::time_point end = Clock::now();
+        latency.add(start, end);
+        for (int b = 0; b < count; b++) {
+            confusion.add(predicted[b], anomalous[first + b]);
+            predictions[first + b] = predicted[b];
+        }
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    allocations.stop();
+
+    printf("%s engine, batches of %d\n", name, BENCH_BATCH_SIZE);
+    latency.print("batch latency");
+    printf("  throughput             %.0f windows/s\n", beats.size() / elapsed);
+    allocations.print();
+    confusion.print("classification");
+    return predictions;
+}
+
+static void printAgreement(const std::vector<bool>& predictions, const std::vector<bool>& reference) {
+    size_t agree = 0;
+    for (size_t i = 0; i < predictions.size(); i++) {
+        agree += predictions[i] == reference[i];
+    }
+    printf("  agreement with float   %.4f (%zu of %zu windows)\n", (double)agree / predictions.size(), agree,
+           predictions.size());
+}
+
+// The two squared-distance forms of the RBF kernel on the same standardized
+// windows: the portable direct (x - sv)^2 loop and the norm expansion the
+// esp-dsp backend uses, which cancels when the norms dwarf the distance
+struct KernelFormStats {
+    double maxDifference = 0.0;
+    double maxDistanceError = 0.0;  // Relative to the direct squared distance
+    size_t windows = 0;
+    size_t signMismatches = 0;
+
+    void add(const FloatModel& model, const float* x) {
+        float xSqNorm = dotProduct(x, x, model.numFeatures);
+        float direct = model.bias;
+        float expanded = model.bias;
+        for (int i = 0; i < model.numSupportVectors; i++) {
+            const float* sv = &model.supportVectors[i * model.numFeatures];
+            float directDistance = squaredDistanceDirect(x, sv, model.numFeatures);
+            float expandedDistance = squaredDistanceExpanded(x, xSqNorm, sv, model.supportVectorSqNorms[i],
+                                                             model.numFeatures);
+            maxDistanceError = std::max(maxDistanceError, std::fabs((double)expandedDistance - directDistance) /
+                                                              std::max(directDistance, 1e-6f));
+            direct += model.dualCoefficients[i] * expf(-model.gamma * directDistance);
+            expanded += model.dualCoefficients[i] * expf(-model.gamma * expandedDistance);
+        }
+        maxDifference = std::max(maxDifference, (double)std::fabs(direct - expanded));
+        signMismatches += (direct < 0) != (expanded < 0);
+        windows++;
+    }
+
+    void print() const {
+        printf("  kernel forms           direct vs norm expansion: max squared distance error %.2e, "
+               "max decision difference %.2e, %zu of %zu decisions differ in sign\n", maxDistanceError,
+               maxDifference, signMismatches, windows);
+    }
+};
+
+static int runBeats(const char* path, double normalLabel) {
+    std::vector<std::vector<float>> beats;
+    std::vector<bool> anomalous;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields = splitFields(line);
+        if ((int)fields.size() < ECG_BUFFER_SIZE + 1) {
+            continue;
+        }
+        std::vector<float> beat(ECG_BUFFER_SIZE);
+        double value = 0.0;
+        bool valid = true;
+        for (int j = 0; j < ECG_BUFFER_SIZE && valid; j++) {
+            valid = parseNumber(fields[j], value);
+            beat[j] = value;
+        }
+        if (!valid || !parseNumber(fields[ECG_BUFFER_SIZE], value)) {
+            continue;  // Header
+        }
+        beats.push_back(beat);
+        anomalous.push_back(value != normalLabel);
+    }
+    if (beats.empty()) {
+        fprintf(stderr, "No beats read from %s\n", path);
+        return 1;
+    }
+    printf("Replaying %zu beats from %s\n", beats.size(), path);
+
+    // Every support vector, no pre-filter: the reference for the other engines
+    FloatModel fullModel = *floatModel;
+    fullModel.remainingPositive = nullptr;
+    fullModel.remainingNegative = nullptr;
+    fullModel.prefilterWeights = nullptr;
+    std::vector<bool> reference = benchmarkBeats("float", fullModel, beats, anomalous);
+    std::vector<bool> cascade = benchmarkBeats(floatModel->prefilterWeights != nullptr ? "float cascade + pre-filter"
+                                                                                        : "float cascade",
+                                               *floatModel, beats, anomalous);
+    printAgreement(cascade, reference);
+    size_t misses = 0;
+    for (size_t i = 0; i < cascade.size(); i++) {
+        misses += reference[i] && !cascade[i];
+    }
+    printf("  pre-filter misses      %zu windows the full decision flags were cleared\n", misses);
+    printAgreement(benchmarkBatches("float", *floatModel, beats, anomalous), reference);
+    KernelFormStats kernelForms;
+    alignas(16) float standardized[ECG_BUFFER_SIZE];
+    for (const std::vector<float>& beat : beats) {
+        for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+            standardized[i] = floatModel->standardize(beat[i], i);
+        }
+        kernelForms.add(*floatModel, standardized);
+    }
+    kernelForms.print();
+#if BENCH_HAS_QUANTIZED
+    printAgreement(benchmarkBeats("quantized", quantizedSvmModel, beats, anomalous), reference);
+    printAgreement(benchmarkBatches("quantized", quantizedSvmModel, beats, anomalous), reference);
+#endif
+#if BENCH_HAS_RFF
+    printAgreement(benchmarkBeats("random Fourier feature", rffModel, beats, anomalous), reference);
+    printAgreement(benchmarkBatches("random Fourier feature", rffModel, beats, anomalous), reference);
+#endif
+    return 0;
+}
+
+// HRV of the last window recomputed from scratch, to check the rolling sums
+static void printHrv(const HrvStats& hrv, const std::vector<uint16_t>& intervals) {
+    std::vector<double> accepted;
+    std::vector<double> differences;
+    uint16_t previous = 0;
+    for (uint16_t interval : intervals) {
+        if (interval < HrvStats::MIN_RR || interval > HrvStats::MAX_RR) {
+            previous = 0;
+            continue;
+        }
+        accepted.push_back(interval);
+        if (previous != 0) {
+            differences.push_back((double)interval - previous);
+        }
+        previous = interval;
+    }
+    size_t n = std::min<size_t>(accepted.size(), HrvStats::WINDOW);
+    size_t m = std::min<size_t>(differences.size(), HrvStats::WINDOW);
+    double mean = 0.0;
+    double spread = 0.0;
+    double squares = 0.0;
+    size_t nn50 = 0;
+    for (size_t i = accepted.size() - n; i < accepted.size(); i++) {
+        mean += accepted[i] / n;
+    }
+    for (size_t i = accepted.size() - n; i < accepted.size(); i++) {
+        spread += (accepted[i] - mean) * (accepted[i] - mean);
+    }
+    for (size_t i = differences.size() - m; i < differences.size(); i++) {
+        squares += differences[i] * differences[i];
+        nn50 += std::fabs(differences[i]) > SAMPLING_RATE * 50 / 1000;
+    }
+    const double toMs = 1000.0 / SAMPLING_RATE;
+    double sdnn = n > 1 ? std::sqrt(spread / (n - 1)) * toMs : 0.0;
+    double rmssd = m > 0 ? std::sqrt(squares / m) * toMs : 0.0;
+    double pnn50 = m > 0 ? (double)nn50 / m : 0.0;
+    bool exact = std::fabs(hrv.sdnn() - sdnn) < 0.01 && std::fabs(hrv.rmssd() - rmssd) < 0.01 &&
+                 std::fabs(hrv.pnn50() - pnn50) < 1e-6;
+    printf("HRV over the last %d beats: mean RR %.1fms, SDNN %.1fms, RMSSD %.1fms, pNN50 %.3f, irregularity %.3f, "
+           "rolling sums %s\n", hrv.intervalCount(), hrv.meanRR(), hrv.sdnn(), hrv.rmssd(), hrv.pnn50(),
+           hrv.irregularity(), exact ? "exact" : "MISMATCH");
+}
+
+// Patient calibration bounds: a session with widely spread decisions must not
+// move the threshold out of reach of anomalies, and a session with many
+// anomalous beats must be rejected. Decisions are in float SVM units.
+static bool checkCalibration() {
+    // 88% of beats just inside the margin, 12% far out: mean 0.1, deviation 1.4
+    ThresholdCalibrator spread;
+    double sum = 0.0, squares = 0.0;
+    for (int i = 0; i < 120; i++) {
+        double decision = i % 25 < 22 ? 0.6 : -3.6;
+        spread.add(decision);
+        sum += decision;
+        squares += decision * decision;
+    }
+    double mean = sum / 120;
+    double uncapped = mean - ThresholdCalibrator::DECISION_SIGMAS * std::sqrt((squares - 120 * mean * mean) / 119);
+    float threshold = spread.threshold();
+    bool bounded = spread.accepted() && threshold >= -ThresholdCalibrator::MAX_THRESHOLD_SHIFT && threshold <= 0.0f;
+
+    // Beats on either side of the calibrated threshold, classified by the
+    // model as the firmware does: a support vector as the window, with the
+    // bias moved so its decision lands just above or just below
+    const float margin = 0.01f;
+    const float* window = floatModel->supportVectors;
+    const float* windows[1] = {window};
+    FloatModel shifted = *floatModel;
+    float deviceThreshold = threshold * floatModel->decisionScale();
+    bool alarms = true;
+    for (int side = -1; side <= 1; side += 2) {
+        shifted.bias = floatModel->bias;
+        shifted.bias += deviceThreshold + side * margin - shifted.decision(window);
+        bool expected = side < 0;  // Below the threshold is anomalous
+        bool batched = !expected;
+        shifted.isAnomalousBatch(windows, 1, &batched, &deviceThreshold);
+        alarms = alarms && shifted.isAnomalous(window, deviceThreshold) == expected && batched == expected;
+    }
+    // Just below the floor still alarms, which the uncapped threshold would have hidden
+    shifted.bias = floatModel->bias;
+    shifted.bias += deviceThreshold - margin - shifted.decision(window);
+    alarms = alarms && !shifted.isAnomalous(window, (float)uncapped * floatModel->decisionScale());
+
+    // 30% anomalous beats: not a normal rhythm to calibrate on
+    ThresholdCalibrator arrhythmic;
+    for (int i = 0; i < 120; i++) {
+        arrhythmic.add(i % 10 < 7 ? 1.0 : -0.5);
+    }
+    bool rejected = !arrhythmic.accepted();
+
+    printf("Calibration: spread-out session threshold %.3f (uncapped %.3f), anomalies still alarm %s; "
+           "session with %.0f%% anomalous beats %s\n", threshold, uncapped, bounded && alarms ? "ok" : "MISMATCH",
+           arrhythmic.anomalousShare() * 100, rejected ? "rejected" : "MISMATCH");
+    return bounded && alarms && rejected;
+}
+
+// Beat segmenter: when R-R drops abruptly, beats are confirmed while earlier
+// segments are still pending. Every beat must still come out exactly once (in
+// the order the segments end) as the unscaled samples of its own window: the
+// input is a ramp, so each segment value tells which sample it came from.
+static bool checkSegmenter() {
+    BeatSegmenter* segmenter = new BeatSegmenter();
+    const uint16_t intervals[] = {500, 500, 500, 110, 110, 110, 500, 300, 110, 110, 400};
+    const int count = sizeof(intervals) / sizeof(intervals[0]);
+    const uint16_t lag = 60;
+    uint32_t peaks[count];
+    bool segmented[count] = {};
+    int confirmed = 0, completed = 0;
+    bool exact = true;
+    uint32_t peak = 600;
+    for (uint32_t n = 0; n < 8000; n++) {
+        EcgSample sample = {};
+        sample.sequence = n;
+        if (confirmed < count && n == peak + lag) {
+            sample.rrInterval = intervals[confirmed];
+            sample.beatLag = lag;
+            peaks[confirmed++] = peak;
+        }
+        if (segmenter->addSample(sample, (float)n)) {
+            int beat = 0;
+            while (beat < confirmed && (peaks[beat] != segmenter->segmentPeak() || segmented[beat])) {
+                beat++;
+            }
+            if (beat == confirmed) {
+                exact = false;
+            } else {
+                uint32_t length = std::min<uint32_t>(std::max<uint32_t>(intervals[beat], BEAT_MIN_SAMPLES),
+                                                     BEAT_MAX_SAMPLES);
+                float first = (float)(peaks[beat] - length / 2);
+                const float* segment = segmenter->segment();
+                exact = exact && segment[0] == first &&
+                        std::fabs(segment[ECG_BUFFER_SIZE - 1] - (first + length - 1)) < 0.01f;
+                segmented[beat] = true;
+            }
+            completed++;
+        }
+        if (sample.rrInterval > 0 && confirmed < count) {
+            peak += intervals[confirmed];
+        }
+    }
+    exact = exact && completed == count && segmenter->droppedBeats() == 0;
+    printf("Beat segmenter: %d of %d beats segmented across R-R drops, %u dropped, segments %s\n", completed, count,
+           (unsigned)segmenter->droppedBeats(), exact ? "exact" : "MISMATCH");
+    delete segmenter;
+    return exact;
+}
+
+static int runRecord(const std::vector<uint16_t>& record, const std::vector<Annotation>& annotations) {
+    // All pipeline state is allocated up front, as on the device
+    EcgFilterChain* filter = new EcgFilterChain();
+    QrsDetector* qrs = new QrsDetector();
+    BeatSegmenter* segmenter = new BeatSegmenter();
+    SlidingAnomalyDetector<FloatModel>* sliding = new SlidingAnomalyDetector<FloatModel>(*floatModel);
+    RecordBlockEncoder* encoder = new RecordBlockEncoder();
+    HrvStats* hrv = new HrvStats();
+    alignas(16) float standardized[ECG_BUFFER_SIZE];
+
+    LatencyStats sampleLatency, frontEndLatency, beatLatency, slidingLatency;
+    sampleLatency.reserve(record.size());
+    frontEndLatency.reserve(record.size());
+    beatLatency.reserve(record.size() / 100 + 16);
+    slidingLatency.reserve(record.size() / ANOMALY_HOP_SIZE + 16);
+
+    struct DetectedBeat {
+        uint32_t peak;
+        bool classified;
+        bool anomalous;
+    };
+    std::vector<DetectedBeat> detected;
+    detected.reserve(record.size() / 50 + 16);
+    std::vector<int16_t> filteredSignal;
+    filteredSignal.reserve(record.size());
+    std::vector<RecordBlock> blocks;
+    blocks.reserve(record.size() / 50 + 16);
+    std::vector<uint16_t> rrIntervals;
+    rrIntervals.reserve(record.size() / 50 + 16);
+    std::vector<bool> slidingResults;
+    slidingResults.reserve(record.size() / ANOMALY_HOP_SIZE + 16);
+
+    uint64_t slidingAnomalies = 0;
+    uint64_t classifiedBeats = 0;
+    uint64_t prefilterMisses = 0;  // Beats isAnomalous() cleared although decision() < 0
+    KernelFormStats kernelForms;
+
+    AllocationScope allocations;
+    Clock::time_point begin = Clock::now();
+    for (size_t n = 0; n < record.size(); n++) {
+        Clock::time_point start = Clock::now();
+
+        // Acquisition task: filter cascade and QRS detection
+        EcgSample sample = {};
+        sample.sequence = n;
+        sample.raw = record[n];
+        sample.filtered = filter->process(record[n]);
+        if (qrs->update(sample.filtered * FILTERED_TO_VOLTS)) {
+            sample.rrInterval = qrs->rrInterval();
+            sample.beatLag = qrs->beatLag();
+            detected.push_back({sample.sequence - sample.beatLag, false, false});
+        }
+        Clock::time_point frontEnd = Clock::now();
+        frontEndLatency.add(start, frontEnd);
+
+        // Processing task: beat-aligned classification
+        float voltage = sample.filtered * FILTERED_TO_VOLTS;
+        if (segmenter->addSample(sample, voltage)) {
+            Clock::time_point beatStart = Clock::now();
+            const float* segment = segmenter->segment();
+            for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+                standardized[i] = floatModel->standardize(segment[i], i);
+            }
+            bool anomalous = floatModel->isAnomalous(standardized);
+            beatLatency.add(beatStart, Clock::now());
+            prefilterMisses += !anomalous && floatModel->decision(standardized) < 0;
+            kernelForms.add(*floatModel, standardized);
+            classifiedBeats++;
+            for (size_t d = detected.size(); d-- > 0;) {
+                if (detected[d].peak == segmenter->segmentPeak()) {
+                    detected[d].classified = true;
+                    detected[d].anomalous = anomalous;
+                    break;
+                }
+            }
+        }
+        if (sample.rrInterval > 0) {
+            hrv->add(sample.rrInterval);
+            rrIntervals.push_back(sample.rrInterval);
+        }
+
+        // Recording
+        if (!encoder->accepts(sample)) {
+            blocks.push_back(encoder->block());
+            encoder->clear();
+        }
+        encoder->add(sample, 0);
+        sampleLatency.add(start, Clock::now());
+
+        // Sliding-window engine, measured separately since it is an alternative
+        Clock::time_point slidingStart = Clock::now();
+        if (sliding->addSample(voltage)) {
+            slidingLatency.add(slidingStart, Clock::now());
+            slidingAnomalies += sliding->lastWindowAnomalous();
+            slidingResults.push_back(sliding->lastWindowAnomalous());
+        }
+        filteredSignal.push_back(sample.filtered);
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    allocations.stop();
+    if (!encoder->empty()) {
+        blocks.push_back(encoder->block());
+    }
+
+    printf("Pipeline (filter + QRS + beat segmenter + float SVM + recorder)\n");
+    frontEndLatency.print("acquisition per sample");
+    sampleLatency.print("pipeline per sample");
+    beatLatency.print("beat classification");
+    slidingLatency.print("sliding window hop");
+    printf("  throughput             %.0f samples/s (%.0fx real time at %dHz)\n",
+           record.size() / elapsed, record.size() / elapsed / SAMPLING_RATE, SAMPLING_RATE);
+    allocations.print();
+
+    // Recording codec: size and lossless round trip
+    std::vector<int16_t> decoded;
+    decoded.reserve(record.size());
+    int16_t blockSamples[RECORD_PAYLOAD_SIZE + 1];
+    bool roundTrip = true;
+    for (const RecordBlock& block : blocks) {
+        int count = decodeRecordBlock(block, blockSamples, RECORD_PAYLOAD_SIZE + 1);
+        if (count < 0) {
+            roundTrip = false;
+            break;
+        }
+        decoded.insert(decoded.end(), blockSamples, blockSamples + count);
+    }
+    roundTrip = roundTrip && decoded == filteredSignal;
+    printf("Recorder: %zu samples in %zu blocks, %.2f bytes/sample, round trip %s\n",
+           record.size(), blocks.size(), (double)blocks.size() * RECORD_BLOCK_SIZE / std::max<size_t>(record.size(), 1),
+           roundTrip ? "exact" : "MISMATCH");
+
+    // QRS detection against annotations, 150ms matching window, skipping the
+    // detector's learning period
+    printf("Detection: %zu beats detected, %llu sliding windows flagged\n", detected.size(),
+           (unsigned long long)slidingAnomalies);
+    printHrv(*hrv, rrIntervals);
+    printf("  pre-filter             %llu of %llu beats cleared that the full decision flags%s\n",
+           (unsigned long long)prefilterMisses, (unsigned long long)classifiedBeats,
+           floatModel->prefilterWeights != nullptr ? "" : " (model has no pre-filter)");
+    kernelForms.print();
+
+    // Sliding windows against isAnomalous() on the same windows: window k
+    // covers samples [k * hop, k * hop + ECG_BUFFER_SIZE)
+    size_t slidingAgree = 0;
+    for (size_t k = 0; k < slidingResults.size(); k++) {
+        for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+            standardized[i] = floatModel->standardize(filteredSignal[k * ANOMALY_HOP_SIZE + i] * FILTERED_TO_VOLTS, i);
+        }
+        slidingAgree += floatModel->isAnomalous(standardized) == slidingResults[k];
+    }
+    printf("  sliding windows        %.4f agreement with full evaluation (%zu of %zu windows)\n",
+           slidingResults.empty() ? 1.0 : (double)slidingAgree / slidingResults.size(), slidingAgree,
+           slidingResults.size());
+    if (!annotations.empty()) {
+        const uint32_t tolerance = SAMPLING_RATE * 150 / 1000;
+        const uint32_t skip = 3 * SAMPLING_RATE;
+        uint64_t annotated = 0;
+        uint64_t matched = 0;
+        uint64_t detectedCounted = 0;
+        ConfusionMatrix confusion;
+        size_t cursor = 0;
+        for (const DetectedBeat& beat : detected) {
+            if (beat.peak < skip) {
+                continue;
+            }
+            detectedCounted++;
+            while (cursor < annotations.size() && annotations[cursor].sample + tolerance < beat.peak) {
+                cursor++;
+            }
+            if (cursor < annotations.size() && annotations[cursor].sample <= beat.peak + tolerance) {
+                matched++;
+                if (beat.classified) {
+                    confusion.add(beat.anomalous, !annotations[cursor].normal);
+                }
+                cursor++;
+            }
+        }
+        for (const Annotation& annotation : annotations) {
+            if (annotation.sample >= skip && annotation.sample < record.size()) {
+                annotated++;
+            }
+        }
+        printf("  QRS sensitivity        %.4f (%llu of %llu annotated beats)\n",
+               annotated ? (double)matched / annotated : 0.0, (unsigned long long)matched,
+               (unsigned long long)annotated);
+        printf("  QRS positive predictivity %.4f (%llu of %llu detections)\n",
+               detectedCounted ? (double)matched / detectedCounted : 0.0, (unsigned long long)matched,
+               (unsigned long long)detectedCounted);
+        confusion.print("beat classification");
+    }
+
+    delete filter;
+    delete qrs;
+    delete segmenter;
+    delete sliding;
+    delete encoder;
+    delete hrv;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const char* beatsPath = nullptr;
+    const char* recordPath = nullptr;
+    const char* annotationsPath = nullptr;
+    int column = 1;
+    double gain = 0.62;
+    double baseline = 1024.0;
+    double syntheticSeconds = 60.0;
+    double normalLabel = 1.0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--beats" && hasValue) {
+            beatsPath = argv[++i];
+        } else if (arg == "--record" && hasValue) {
+            recordPath = argv[++i];
+        } else if (arg == "--annotations" && hasValue) {
+            annotationsPath = argv[++i];
+        } else if (arg == "--column" && hasValue) {
+            column = atoi(argv[++i]);
+        } else if (arg == "--gain" && hasValue) {
+            gain = atof(argv[++i]);
+        } else if (arg == "--baseline" && hasValue) {
+            baseline = atof(argv[++i]);
+        } else if (arg == "--synthetic" && hasValue) {
+            syntheticSeconds = atof(argv[++i]);
+        } else if (arg == "--normal-label" && hasValue) {
+            normalLabel = atof(argv[++i]);
+        } else if (arg == "--model" && hasValue) {
+            if (!loadModelFile(argv[++i])) {
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Usage: %s [--beats FILE] [--record FILE [--column N] [--gain G] [--baseline B] "
+                            "[--annotations FILE]] [--synthetic SECONDS] [--normal-label L] [--model FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("Model: %d support vectors, %d features, %s kernel backend%s\n", floatModel->numSupportVectors,
+           floatModel->numFeatures, SVM_USE_ESP_DSP ? "esp-dsp" : "scalar",
+           BENCH_HAS_QUANTIZED ? ", quantized model available" : "");
+#if BENCH_HAS_RFF
+    printf("Random Fourier feature model: %d components\n", rffModel.numComponents);
+#endif
+
+    if (!checkCalibration() || !checkSegmenter()) {
+        return 1;
+    }
+
+    if (beatsPath) {
+        return runBeats(beatsPath, normalLabel);
+    }
+
+    std::vector<uint16_t> record;
+    std::vector<Annotation> annotations;
+    if (recordPath) {
+        record = loadRecord(recordPath, column, gain, baseline);
+        if (annotationsPath) {
+            annotations = loadAnnotations(annotationsPath);
+        }
+        printf("Replaying %zu samples (%.1fs) from %s\n", record.size(), (double)record.size() / SAMPLING_RATE,
+               recordPath);
+    } else {
+        record = synthesizeRecord(syntheticSeconds, annotations);
+        printf("Replaying %.0fs of synthetic ECG (%zu beats)\n", syntheticSeconds, annotations.size());
+    }
+    if (record.empty()) {
+        fprintf(stderr, "No samples to replay\n");
+        return 1;
+    }
+    return runRecord(record, annotations);
+}
@@ -0,0 +1,43 @@
+# Web Asset Packaging for ESP32
+# This script gzips the dashboard in "Web Files/" into data/www/ for the SPIFFS image
+
+import argparse
+import gzip
+import os
+import shutil
+
+parser = argparse.ArgumentParser(description="Gzip the web interface for the ESP32 filesystem image")
+parser.add_argument("--source", default="Web Files", help="directory with the web interface files")
+parser.add_argument("--output", default=os.path.join("data", "www"),
+                    help="directory mirrored into SPIFFS (served from /www)")
+args = parser.parse_args()
+
+# Start from an empty output so deleted assets do not linger in the image
+if os.path.isdir(args.output):
+    shutil.rmtree(args.output)
+
+total_raw = 0
+total_gz = 0
+for root, _, files in os.walk(args.source):
+    for name in sorted(files):
+        source_path = os.path.join(root, name)
+        relative = os.path.relpath(source_path, args.source)
+        target_path = os.path.join(args.output, relative + ".gz")
+        os.makedirs(os.path.dirname(target_path), exist_ok=True)
+
+        with open(source_path, "rb") as f:
+            content = f.read()
+
+        # mtime=0 makes the output depend on the content only, so the ETag the
+        # firmware derives from the gzip trailer changes only when the file does
+        with open(target_path, "wb") as f:
+            with gzip.GzipFile(filename="", mode="wb", fileobj=f, compresslevel=9, mtime=0) as gz:
+                gz.write(content)
+
+        gz_size = os.path.getsize(target_path)
+        total_raw += len(content)
+        total_gz += gz_size
+        print(f"{relative}: {len(content)} -> {gz_size} bytes")
+
+print(f"Total: {total_raw} -> {total_gz} bytes, written to {args.output}")
+print("Upload the data/ folder as the SPIFFS image (e.g. ESP32 Sketch Data Upload)")
@@ -0,0 +1,73 @@
+#include "beat_segmenter.h"
+
+bool BeatSegmenter::addSample(const EcgSample& sample, float value) {
+    // A gap means the history no longer lines up with sequence numbers
+    if (historyCount > 0 && sample.sequence != nextSequence) {
+        reset();
+    }
+    history[sample.sequence & (BEAT_HISTORY_SIZE - 1)] = value;
+    nextSequence = sample.sequence + 1;
+    if (historyCount < BEAT_HISTORY_SIZE) {
+        historyCount++;
+    }
+    
+    // A pending segment completes at most half an R-R interval after its
+    // peak; the first to complete is extracted, the others keep their place
+    bool completed = false;
+    for (int i = 0; i < pendingCount; i++) {
+        if (nextSequence - pending[i].start >= pending[i].length) {
+            extractSegment(pending[i]);
+            for (int j = i + 1; j < pendingCount; j++) {
+                pending[j - 1] = pending[j];
+            }
+            pendingCount--;
+            completed = true;
+            break;
+        }
+    }
+    
+    if (sample.rrInterval > 0) {
+        uint32_t length = sample.rrInterval;
+        if (length < BEAT_MIN_SAMPLES) {
+            length = BEAT_MIN_SAMPLES;
+        } else if (length > BEAT_MAX_SAMPLES) {
+            length = BEAT_MAX_SAMPLES;
+        }
+        
+        uint32_t peak = sample.sequence - sample.beatLag;
+        uint32_t start = peak - length / 2;
+        // Only segment beats whose start is still in the history
+        if (nextSequence - start <= historyCount) {
+            if (pendingCount == BEAT_PENDING_COUNT) {
+                // Cannot happen at physiological rates; keep the newest beats
+                for (int j = 1; j < pendingCount; j++) {
+                    pending[j - 1] = pending[j];
+                }
+                pendingCount--;
+                droppedCount++;
+            }
+            pending[pendingCount++] = {start, length, peak};
+        }
+    }
+    return completed;
+}
+
+void BeatSegmenter::reset() {
+    historyCount = 0;
+    pendingCount = 0;
+}
+
+void BeatSegmenter::extractSegment(const PendingSegment& beat) {
+    // Linear resampling of beat.length samples onto ECG_BUFFER_SIZE points
+    float step = (float)(beat.length - 1) / (ECG_BUFFER_SIZE - 1);
+    for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+        float position = i * step;
+        uint32_t index = (uint32_t)position;
+        float fraction = position - index;
+        float current = history[(beat.start + index) & (BEAT_HISTORY_SIZE - 1)];
+        float next = index + 1 < beat.length ?
+                     history[(beat.start + index + 1) & (BEAT_HISTORY_SIZE - 1)] : current;
+        segmentBuffer[i] = current + fraction * (next - current);
+    }
+    segmentPeakSequence = beat.peak;
+}
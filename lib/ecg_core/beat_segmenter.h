@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include "ecg_config.h"
+
+// Beat-aligned segmentation
+// The model classifies single heartbeats, 140 samples long. For every beat the
+// segmenter takes the last R-R interval centred on the R-peak and resamples it
+// to ECG_BUFFER_SIZE points. Segments stay in volts: the model's own
+// standardization (its training scaler) is the only scaling applied, as on the
+// sliding-window path.
+const int BEAT_MIN_SAMPLES = SAMPLING_RATE * 3 / 10;   // 0.3s, R-R of 200bpm
+const int BEAT_MAX_SAMPLES = SAMPLING_RATE * 3 / 2;    // 1.5s, R-R of 40bpm
+const int BEAT_HISTORY_SIZE = 1024;                    // Power of two, > max segment + detector lag
+static_assert(BEAT_HISTORY_SIZE > BEAT_MAX_SAMPLES + SAMPLING_RATE / 2, "Beat history too short");
+// A beat is confirmed up to half a (long) R-R interval before the previous
+// segment ends, so a sudden drop in R-R leaves several segments pending
+const int BEAT_PENDING_COUNT = 4;
+
+class BeatSegmenter {
+public:
+    // Adds one sample; returns true when a beat segment is complete, in which
+    // case segment() holds it. At most one segment completes per sample; one
+    // that is ready at the same time follows on the next sample.
+    bool addSample(const EcgSample& sample, float value);
+    const float* segment() const { return segmentBuffer; }
+    // Sequence of the R-peak of the beat in segment()
+    uint32_t segmentPeak() const { return segmentPeakSequence; }
+    // Beats discarded because BEAT_PENDING_COUNT segments were already pending
+    uint32_t droppedBeats() const { return droppedCount; }
+    // Forgets the history and any pending beat, e.g. after a gap in the signal
+    void reset();
+
+private:
+    struct PendingSegment {
+        uint32_t start;          // Sequence of the first sample
+        uint32_t length;
+        uint32_t peak;           // Sequence of the R-peak
+    };
+    
+    void extractSegment(const PendingSegment& beat);
+    
+    float history[BEAT_HISTORY_SIZE];
+    uint32_t nextSequence = 0;   // Sequence expected for the next sample
+    uint32_t historyCount = 0;
+    
+    PendingSegment pending[BEAT_PENDING_COUNT];  // In the order the beats were confirmed
+    int pendingCount = 0;
+    uint32_t droppedCount = 0;
+    
+    float segmentBuffer[ECG_BUFFER_SIZE];
+    uint32_t segmentPeakSequence = 0;
+};
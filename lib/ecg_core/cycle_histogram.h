@@ -0,0 +1,45 @@
+// Hot-path latency histograms
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Power-of-two buckets of CPU cycles: bucket i counts durations up to
+// 2^(CYCLE_HISTOGRAM_MIN_SHIFT + i) cycles and the last bucket catches the
+// rest, which at 240MHz spans ~1us to ~70ms. Recording is a count-leading-
+// zeros and three relaxed atomic adds, cheap enough for every sample.
+const int CYCLE_HISTOGRAM_MIN_SHIFT = 8;  // 256 cycles
+const int CYCLE_HISTOGRAM_BUCKETS = 18;   // 17 bounded buckets up to 2^24, then +Inf
+
+// One task records, any task may read; readers can see a recording half
+// applied, which only ever skews a scrape by one observation
+class CycleHistogram {
+public:
+    void record(uint32_t cycles) {
+        buckets[bucketIndex(cycles)].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(cycles, std::memory_order_relaxed);
+        if (cycles > largest.load(std::memory_order_relaxed)) {
+            largest.store(cycles, std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t bucketCount(int bucket) const { return buckets[bucket].load(std::memory_order_relaxed); }
+    uint64_t sum() const { return total.load(std::memory_order_relaxed); }
+    uint32_t max() const { return largest.load(std::memory_order_relaxed); }
+
+    // Upper bound of a bounded bucket, in cycles
+    static uint32_t bucketBound(int bucket) { return 1u << (CYCLE_HISTOGRAM_MIN_SHIFT + bucket); }
+
+    static int bucketIndex(uint32_t cycles) {
+        if (cycles <= (1u << CYCLE_HISTOGRAM_MIN_SHIFT)) {
+            return 0;
+        }
+        int ceilLog2 = 32 - __builtin_clz(cycles - 1);
+        int index = ceilLog2 - CYCLE_HISTOGRAM_MIN_SHIFT;
+        return index < CYCLE_HISTOGRAM_BUCKETS - 1 ? index : CYCLE_HISTOGRAM_BUCKETS - 1;
+    }
+
+private:
+    std::atomic<uint32_t> buckets[CYCLE_HISTOGRAM_BUCKETS] = {};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint32_t> largest{0};
+};
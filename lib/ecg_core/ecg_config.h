@@ -0,0 +1,16 @@
+// Signal chain configuration shared by the firmware and the host benchmark
+#pragma once
+#include <cstdint>
+
+const int ECG_BUFFER_SIZE = 140;              // Size of our feature vector
+const int SAMPLING_RATE = 360;                // Sampling rate in Hz
+const float ADC_TO_VOLTS = 3.3 / 4095.0;      // 0-3.3V for ESP32 ADC
+
+// One sample handed from the acquisition task to the processing task
+struct EcgSample {
+    uint32_t sequence;    // Index of this sample since boot
+    uint16_t raw;         // Raw 12-bit ADC code
+    int16_t filtered;     // Output of the filter cascade, ADC codes << FILTER_INPUT_SHIFT, zero-centred
+    uint16_t rrInterval;  // R-R interval in samples if a beat was confirmed at this sample, else 0
+    uint16_t beatLag;     // For a confirmed beat, how many samples earlier the R-peak was
+};
@@ -0,0 +1,95 @@
+#include "ecg_filters.h"
+#include <cmath>
+
+static const float FILTER_PI = 3.14159265358979f;
+
+Biquad makeLowpass(float cutoffHz, float sampleRate) {
+    // Butterworth (Q = 1/sqrt(2)) low-pass, bilinear transform
+    float w0 = 2.0f * FILTER_PI * cutoffHz / sampleRate;
+    float alpha = sinf(w0) / (2.0f * M_SQRT1_2);
+    float a0 = 1.0f + alpha;
+    float cosW0 = cosf(w0);
+    Biquad filter = {};
+    filter.b0 = (1.0f - cosW0) / 2.0f / a0;
+    filter.b1 = (1.0f - cosW0) / a0;
+    filter.b2 = filter.b0;
+    filter.a1 = -2.0f * cosW0 / a0;
+    filter.a2 = (1.0f - alpha) / a0;
+    return filter;
+}
+
+Biquad makeHighpass(float cutoffHz, float sampleRate) {
+    // Butterworth (Q = 1/sqrt(2)) high-pass, bilinear transform
+    float w0 = 2.0f * FILTER_PI * cutoffHz / sampleRate;
+    float alpha = sinf(w0) / (2.0f * M_SQRT1_2);
+    float a0 = 1.0f + alpha;
+    float cosW0 = cosf(w0);
+    Biquad filter = {};
+    filter.b0 = (1.0f + cosW0) / 2.0f / a0;
+    filter.b1 = -(1.0f + cosW0) / a0;
+    filter.b2 = filter.b0;
+    filter.a1 = -2.0f * cosW0 / a0;
+    filter.a2 = (1.0f - alpha) / a0;
+    return filter;
+}
+
+Biquad makeNotch(float centerHz, float q, float sampleRate) {
+    float w0 = 2.0f * FILTER_PI * centerHz / sampleRate;
+    float alpha = sinf(w0) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+    float cosW0 = cosf(w0);
+    Biquad filter = {};
+    filter.b0 = 1.0f / a0;
+    filter.b1 = -2.0f * cosW0 / a0;
+    filter.b2 = filter.b0;
+    filter.a1 = filter.b1;
+    filter.a2 = (1.0f - alpha) / a0;
+    return filter;
+}
+
+FixedBiquad FixedBiquad::fromFloat(const Biquad& filter) {
+    const float scale = (float)(1L << FILTER_COEFF_BITS);
+    FixedBiquad fixed = {};
+    fixed.b0 = lroundf(filter.b0 * scale);
+    fixed.b1 = lroundf(filter.b1 * scale);
+    fixed.b2 = lroundf(filter.b2 * scale);
+    fixed.a1 = lroundf(filter.a1 * scale);
+    fixed.a2 = lroundf(filter.a2 * scale);
+    return fixed;
+}
+
+EcgFilterChain::EcgFilterChain() {
+    reset();
+}
+
+void EcgFilterChain::reset() {
+#if FILTER_STAGES > 0
+    int stage = 0;
+#if ECG_FILTER_HIGHPASS
+    stages[stage++] = FixedBiquad::fromFloat(makeHighpass(FILTER_HIGHPASS_HZ, SAMPLING_RATE));
+#endif
+#if ECG_FILTER_NOTCH
+    stages[stage++] = FixedBiquad::fromFloat(makeNotch(MAINS_FREQUENCY, FILTER_NOTCH_Q, SAMPLING_RATE));
+#endif
+#if ECG_FILTER_LOWPASS
+    stages[stage++] = FixedBiquad::fromFloat(makeLowpass(FILTER_LOWPASS_HZ, SAMPLING_RATE));
+#endif
+#endif
+}
+
+int16_t EcgFilterChain::process(uint16_t raw) {
+    // Centre on mid-scale so the stages work on a signed signal
+    int32_t value = ((int32_t)raw - 2048) * (1 << FILTER_INPUT_SHIFT);  // Not <<: negative before C++20
+#if FILTER_STAGES > 0
+    for (int i = 0; i < FILTER_STAGES; i++) {
+        value = stages[i].process(value);
+    }
+#endif
+    // Saturate: electrode reconnects can overshoot past full scale
+    if (value > INT16_MAX) {
+        value = INT16_MAX;
+    } else if (value < INT16_MIN) {
+        value = INT16_MIN;
+    }
+    return value;
+}
@@ -0,0 +1,80 @@
+// ECG filter stages
+#pragma once
+#include <cstdint>
+#include "ecg_config.h"
+
+// Second-order IIR section (transposed direct form II)
+struct Biquad {
+    float b0, b1, b2, a1, a2;
+    float z1, z2;
+    
+    float process(float x) {
+        float y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+        return y;
+    }
+};
+
+Biquad makeLowpass(float cutoffHz, float sampleRate);
+Biquad makeHighpass(float cutoffHz, float sampleRate);
+Biquad makeNotch(float centerHz, float q, float sampleRate);
+
+// Filter cascade applied once to the sample stream; every stage can be
+// disabled at compile time
+#ifndef ECG_FILTER_HIGHPASS
+#define ECG_FILTER_HIGHPASS 1   // Baseline wander removal
+#endif
+#ifndef ECG_FILTER_NOTCH
+#define ECG_FILTER_NOTCH 1      // Mains interference removal
+#endif
+#ifndef ECG_FILTER_LOWPASS
+#define ECG_FILTER_LOWPASS 1    // EMG / high-frequency noise removal
+#endif
+#ifndef MAINS_FREQUENCY
+#define MAINS_FREQUENCY 50      // 50Hz or 60Hz depending on region
+#endif
+#define FILTER_STAGES (ECG_FILTER_HIGHPASS + ECG_FILTER_NOTCH + ECG_FILTER_LOWPASS)
+
+const float FILTER_HIGHPASS_HZ = 0.5;
+const float FILTER_NOTCH_Q = 20.0;
+const float FILTER_LOWPASS_HZ = 40.0;
+const int FILTER_INPUT_SHIFT = 3;      // 12-bit codes -> Q15 with 6dB headroom
+const int FILTER_COEFF_BITS = 28;      // Coefficients in Q28 (|a1| < 2 fits int32)
+const float FILTERED_TO_VOLTS = ADC_TO_VOLTS / (1 << FILTER_INPUT_SHIFT);
+
+// Fixed-point biquad (direct form I, 64-bit accumulator). The truncation
+// error is fed back into the next output so the 0.5Hz high-pass, whose poles
+// sit very close to the unit circle, does not build up a DC offset.
+struct FixedBiquad {
+    int32_t b0, b1, b2, a1, a2;   // Q28
+    int32_t x1, x2, y1, y2;
+    int64_t error;
+    
+    static FixedBiquad fromFloat(const Biquad& filter);
+    
+    int32_t process(int32_t x) {
+        int64_t acc = error + (int64_t)b0 * x + (int64_t)b1 * x1 + (int64_t)b2 * x2 -
+                      (int64_t)a1 * y1 - (int64_t)a2 * y2;
+        int32_t y = (int32_t)(acc >> FILTER_COEFF_BITS);
+        error = acc - (int64_t)y * (1LL << FILTER_COEFF_BITS);
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        return y;
+    }
+};
+
+class EcgFilterChain {
+public:
+    EcgFilterChain();
+    // Filters one raw ADC code; output is zero-centred, in ADC codes << FILTER_INPUT_SHIFT
+    int16_t process(uint16_t raw);
+    void reset();
+
+private:
+#if FILTER_STAGES > 0
+    FixedBiquad stages[FILTER_STAGES];
+#endif
+};
@@ -0,0 +1,101 @@
+#include "hrv_stats.h"
+#include <cmath>
+#include <cstdlib>
+
+static const float SAMPLES_TO_MS = 1000.0f / SAMPLING_RATE;
+
+HrvStats::HrvStats() {
+    reset();
+}
+
+void HrvStats::reset() {
+    rrCount = rrIndex = 0;
+    differenceCount = differenceIndex = 0;
+    rrSum = 0;
+    rrSquareSum = 0;
+    differenceSquareSum = 0;
+    nn50Count = 0;
+    previousRR = 0;
+}
+
+void HrvStats::add(uint16_t rrInterval) {
+    if (rrInterval < MIN_RR || rrInterval > MAX_RR) {
+        previousRR = 0;
+        return;
+    }
+
+    // The oldest interval leaves the window once it is full
+    if (rrCount == WINDOW) {
+        uint16_t oldest = rrRing[rrIndex];
+        rrSum -= oldest;
+        rrSquareSum -= (uint32_t)oldest * oldest;
+    } else {
+        rrCount++;
+    }
+    rrRing[rrIndex] = rrInterval;
+    rrIndex = (rrIndex + 1) % WINDOW;
+    rrSum += rrInterval;
+    rrSquareSum += (uint32_t)rrInterval * rrInterval;
+
+    if (previousRR != 0) {
+        if (differenceCount == WINDOW) {
+            int16_t oldest = differenceRing[differenceIndex];
+            differenceSquareSum -= (uint32_t)(oldest * oldest);
+            nn50Count -= abs(oldest) > NN50_SAMPLES;
+        } else {
+            differenceCount++;
+        }
+        int16_t difference = (int16_t)(rrInterval - previousRR);
+        differenceRing[differenceIndex] = difference;
+        differenceIndex = (differenceIndex + 1) % WINDOW;
+        differenceSquareSum += (uint32_t)(difference * difference);
+        nn50Count += abs(difference) > NN50_SAMPLES;
+    }
+    previousRR = rrInterval;
+}
+
+float HrvStats::meanRR() const {
+    if (rrCount == 0) {
+        return 0.0f;
+    }
+    return (float)rrSum / rrCount * SAMPLES_TO_MS;
+}
+
+float HrvStats::meanHeartRate() const {
+    if (rrCount == 0) {
+        return 0.0f;
+    }
+    return 60.0f * SAMPLING_RATE * rrCount / rrSum;
+}
+
+float HrvStats::sdnn() const {
+    if (rrCount < 2) {
+        return 0.0f;
+    }
+    // n * sum(x^2) - sum(x)^2 is computed exactly in 64 bits
+    uint64_t n = rrCount;
+    uint64_t spread = n * rrSquareSum - (uint64_t)rrSum * rrSum;
+    return sqrtf((float)spread / (float)(n * (n - 1))) * SAMPLES_TO_MS;
+}
+
+float HrvStats::rmssd() const {
+    if (differenceCount == 0) {
+        return 0.0f;
+    }
+    return sqrtf((float)differenceSquareSum / differenceCount) * SAMPLES_TO_MS;
+}
+
+float HrvStats::pnn50() const {
+    if (differenceCount == 0) {
+        return 0.0f;
+    }
+    return (float)nn50Count / differenceCount;
+}
+
+float HrvStats::irregularity() const {
+    float mean = meanRR();
+    if (mean == 0.0f) {
+        return 0.0f;
+    }
+    return rmssd() / mean;
+}
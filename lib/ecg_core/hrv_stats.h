@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include "ecg_config.h"
+
+// Rolling heart rate variability over the last WINDOW R-R intervals
+// The intervals and their successive differences live in fixed rings; integer
+// sums of the intervals, their squares and the squared differences are
+// updated as beats enter and leave the window, so every statistic is O(1)
+// per beat and exact, with no floating-point drift over a long recording.
+class HrvStats {
+public:
+    static const int WINDOW = 64;                               // ~1 minute at 60 BPM
+    static const uint16_t MIN_RR = SAMPLING_RATE * 300 / 1000;  // 200 BPM
+    static const uint16_t MAX_RR = SAMPLING_RATE * 2000 / 1000; // 30 BPM
+
+    HrvStats();
+    // Adds the R-R interval (samples) of a confirmed beat. An implausible
+    // interval (a missed or spurious beat) is dropped and breaks the
+    // succession: no successive difference spans it.
+    void add(uint16_t rrInterval);
+    void reset();
+
+    int intervalCount() const { return rrCount; }
+    float meanRR() const;         // ms, 0 without intervals
+    float meanHeartRate() const;  // BPM from the mean interval, 0 without intervals
+    float sdnn() const;           // ms, standard deviation of the intervals
+    float rmssd() const;          // ms, root mean square of the successive differences
+    float pnn50() const;          // Fraction of successive differences above 50ms
+    // RMSSD relative to the mean interval; values above about 0.1 suggest an
+    // irregular rhythm such as atrial fibrillation
+    float irregularity() const;
+
+private:
+    static const int NN50_SAMPLES = SAMPLING_RATE * 50 / 1000;
+
+    uint16_t rrRing[WINDOW];
+    int16_t differenceRing[WINDOW];
+    int rrCount, rrIndex;
+    int differenceCount, differenceIndex;
+    uint32_t rrSum;
+    uint64_t rrSquareSum;
+    uint64_t differenceSquareSum;
+    int nn50Count;                            // Differences in the window above NN50_SAMPLES
+    uint16_t previousRR;                      // Last accepted interval, 0 after a break
+};
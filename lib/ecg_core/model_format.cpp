@@ -0,0 +1,89 @@
+#include "model_format.h"
+
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+    // Half-byte table: 64 bytes of constants, fast enough for a load-time check
+    static const uint32_t NIBBLE_TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ NIBBLE_TABLE[crc & 0x0F];
+        crc = (crc >> 4) ^ NIBBLE_TABLE[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// A section of count floats at offset must be aligned and inside the file
+static bool sectionFits(uint32_t offset, uint32_t count, const ModelFileHeader& header) {
+    return offset % MODEL_FILE_ALIGNMENT == 0 && offset >= header.headerSize &&
+           offset <= header.totalSize && count <= (header.totalSize - offset) / sizeof(float);
+}
+
+bool parseModelFile(const uint8_t* data, size_t size, int numFeatures, int maxSupportVectors,
+                    ModelFileView& view, const char*& error) {
+    if ((uintptr_t)data % MODEL_FILE_ALIGNMENT != 0) {
+        error = "model buffer is not aligned";
+        return false;
+    }
+    if (size < sizeof(ModelFileHeader)) {
+        error = "file too short";
+        return false;
+    }
+    const ModelFileHeader& header = *(const ModelFileHeader*)data;
+    if (header.magic != MODEL_FILE_MAGIC) {
+        error = "not a model file";
+        return false;
+    }
+    if (header.version < 1 || header.version > MODEL_FILE_VERSION || header.headerSize < sizeof(ModelFileHeader)) {
+        error = "unsupported model file version";
+        return false;
+    }
+    if (header.totalSize > size || header.totalSize < header.headerSize) {
+        error = "file truncated";
+        return false;
+    }
+    if ((int)header.numFeatures != numFeatures) {
+        error = "feature count does not match the ECG window";
+        return false;
+    }
+    if (header.numSupportVectors == 0 || (int)header.numSupportVectors > maxSupportVectors) {
+        error = "too many support vectors";
+        return false;
+    }
+    uint32_t supportVectors = header.numSupportVectors;
+    if (!sectionFits(header.supportVectorsOffset, supportVectors * header.numFeatures, header) ||
+        !sectionFits(header.dualCoefficientsOffset, supportVectors, header) ||
+        !sectionFits(header.supportVectorSqNormsOffset, supportVectors, header) ||
+        !sectionFits(header.featureMeansOffset, header.numFeatures, header) ||
+        !sectionFits(header.featureStdsOffset, header.numFeatures, header)) {
+        error = "section out of bounds";
+        return false;
+    }
+    uint32_t prefilterOffset = header.version >= 2 ? header.prefilterOffset : 0;
+    if (prefilterOffset != 0 && !sectionFits(prefilterOffset, 4 + header.numFeatures, header)) {
+        error = "section out of bounds";
+        return false;
+    }
+    
+    uint32_t crc = crc32Update(0, data, offsetof(ModelFileHeader, crc32));
+    if (header.version >= 2) {
+        size_t afterCrc = offsetof(ModelFileHeader, crc32) + sizeof(header.crc32);
+        crc = crc32Update(crc, data + afterCrc, header.headerSize - afterCrc);
+    }
+    crc = crc32Update(crc, data + header.headerSize, header.totalSize - header.headerSize);
+    if (crc != header.crc32) {
+        error = "checksum mismatch";
+        return false;
+    }
+    
+    view.header = &header;
+    view.supportVectors = (const float*)(data + header.supportVectorsOffset);
+    view.dualCoefficients = (const float*)(data + header.dualCoefficientsOffset);
+    view.supportVectorSqNorms = (const float*)(data + header.supportVectorSqNormsOffset);
+    view.featureMeans = (const float*)(data + header.featureMeansOffset);
+    view.featureStds = (const float*)(data + header.featureStdsOffset);
+    view.prefilter = prefilterOffset != 0 ? (const float*)(data + prefilterOffset) : nullptr;
+    return true;
+}
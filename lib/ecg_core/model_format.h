@@ -0,0 +1,65 @@
+// Binary SVM model files
+// Written by svm-extraction.py --binary and read in place on the device, so
+// every section is 16-byte aligned relative to the start of the file and the
+// arrays can be used straight from a memory-mapped flash partition.
+// Layout (little-endian):
+//   ModelFileHeader                    64 bytes
+//   float supportVectors[N * F]        flattened, at supportVectorsOffset
+//   float dualCoefficients[N]          alpha_i * y_i
+//   float supportVectorSqNorms[N]      ||sv||^2
+//   float featureMeans[F]
+//   float featureStds[F]
+//   float prefilter[4 + F]             optional (version 2): bias, threshold,
+//                                      two pad words, then the weights
+// Support vectors are stored by decreasing |alpha| so the cascade in
+// SVMModel::isAnomalous can stop early; any order gives the same decisions.
+// The CRC-32 (zlib) covers the header except the crc field (version 1: only
+// the part before it), then the bytes from headerSize to totalSize.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+const uint32_t MODEL_FILE_MAGIC = 0x424D5653;  // "SVMB"
+const uint16_t MODEL_FILE_VERSION = 2;  // Version 1 files (no pre-filter) still load
+const size_t MODEL_FILE_ALIGNMENT = 16;
+
+struct __attribute__((packed)) ModelFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;              // Sections start after this, newer versions may grow it
+    uint32_t numSupportVectors;
+    uint32_t numFeatures;
+    float gamma;
+    float bias;
+    uint32_t supportVectorsOffset;    // Byte offsets from the start of the file
+    uint32_t dualCoefficientsOffset;
+    uint32_t supportVectorSqNormsOffset;
+    uint32_t featureMeansOffset;
+    uint32_t featureStdsOffset;
+    uint32_t totalSize;
+    uint32_t modelId;                 // Chosen by the extractor, identifies the model in reports
+    uint32_t crc32;
+    uint32_t prefilterOffset;         // 0 when the file has no linear pre-filter
+    uint32_t reserved;
+};
+static_assert(sizeof(ModelFileHeader) == 64, "Model file header must stay 64 bytes");
+
+// Pointers into a validated model file; nothing is copied
+struct ModelFileView {
+    const ModelFileHeader* header;
+    const float* supportVectors;
+    const float* dualCoefficients;
+    const float* supportVectorSqNorms;
+    const float* featureMeans;
+    const float* featureStds;
+    const float* prefilter;           // nullptr, or bias, threshold, pad, pad, weights[F]
+};
+
+// Checks the header, section bounds and alignment, the expected feature count
+// and the CRC. data must be 16-byte aligned. Returns false with a short
+// description in error when the file cannot be used.
+bool parseModelFile(const uint8_t* data, size_t size, int numFeatures, int maxSupportVectors,
+                    ModelFileView& view, const char*& error);
+
+// zlib-compatible CRC-32; pass the previous result to continue a checksum
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length);
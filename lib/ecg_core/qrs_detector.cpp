@@ -0,0 +1,173 @@
+#include "qrs_detector.h"
+#include <cmath>
+#include <cstring>
+
+QrsDetector::QrsDetector() {
+    reset();
+}
+
+void QrsDetector::reset() {
+    highpass = makeHighpass(5.0f, SAMPLING_RATE);
+    lowpass = makeLowpass(15.0f, SAMPLING_RATE);
+    memset(derivativeHistory, 0, sizeof(derivativeHistory));
+    memset(integratorWindow, 0, sizeof(integratorWindow));
+    integratorSum = 0.0f;
+    integratorIndex = 0;
+    memset(inputHistory, 0, sizeof(inputHistory));
+    previousIntegrated[0] = previousIntegrated[1] = 0.0f;
+    maxSlope = 0.0f;
+    sampleIndex = 0;
+    signalPeak = noisePeak = 0.0f;
+    learningMax = learningSum = 0.0f;
+    lastBeatIndex = 0;
+    haveBeat = false;
+    lastQrsSlope = 0.0f;
+    searchBackValue = 0.0f;
+    searchBackSlope = 0.0f;
+    searchBackIndex = 0;
+    rrSum = 0;
+    rrCount = rrIndex = 0;
+    lastRRInterval = 0;
+    lastBeatLag = 0;
+}
+
+bool QrsDetector::update(float value) {
+    uint32_t index = sampleIndex++;
+    inputHistory[index & (HISTORY_SIZE - 1)] = value;
+    
+    // Bandpass 5-15Hz keeps the QRS energy and rejects baseline and T-waves
+    float filtered = lowpass.process(highpass.process(value));
+    
+    // Five-point derivative: (2x[n] + x[n-1] - x[n-3] - 2x[n-4]) / 8
+    float derivative = (2.0f * filtered + derivativeHistory[0] - derivativeHistory[2] -
+                        2.0f * derivativeHistory[3]) / 8.0f;
+    derivativeHistory[3] = derivativeHistory[2];
+    derivativeHistory[2] = derivativeHistory[1];
+    derivativeHistory[1] = derivativeHistory[0];
+    derivativeHistory[0] = filtered;
+    float slope = fabsf(derivative);
+    if (slope > maxSlope) {
+        maxSlope = slope;
+    }
+    
+    // Squaring and moving-window integration
+    float squared = derivative * derivative;
+    integratorSum += squared - integratorWindow[integratorIndex];
+    integratorWindow[integratorIndex] = squared;
+    if (++integratorIndex == INTEGRATION_WINDOW) {
+        integratorIndex = 0;
+        // Resum once per window so float rounding cannot accumulate
+        integratorSum = 0.0f;
+        for (int i = 0; i < INTEGRATION_WINDOW; i++) {
+            integratorSum += integratorWindow[i];
+        }
+    }
+    float integrated = integratorSum / INTEGRATION_WINDOW;
+    
+    // Learning phase: seed the thresholds from the first two seconds
+    if (index < LEARNING_SAMPLES) {
+        learningMax = fmaxf(learningMax, integrated);
+        learningSum += integrated;
+        if (index == LEARNING_SAMPLES - 1) {
+            signalPeak = learningMax / 3.0f;
+            noisePeak = learningSum / LEARNING_SAMPLES / 2.0f;
+        }
+        previousIntegrated[1] = previousIntegrated[0];
+        previousIntegrated[0] = integrated;
+        return false;
+    }
+    
+    float threshold = noisePeak + 0.25f * (signalPeak - noisePeak);
+    bool beat = false;
+    
+    // A local maximum of the integrated signal is a candidate peak
+    if (previousIntegrated[0] > previousIntegrated[1] && previousIntegrated[0] >= integrated) {
+        float peak = previousIntegrated[0];
+        uint32_t sinceBeat = index - lastBeatIndex;
+        float candidateSlope = maxSlope;
+        maxSlope = 0.0f;
+        
+        if (!haveBeat || sinceBeat > REFRACTORY_SAMPLES) {
+            // A high peak soon after a beat with a shallow slope is a T-wave
+            bool tWave = haveBeat && sinceBeat < T_WAVE_WINDOW && candidateSlope < 0.5f * lastQrsSlope;
+            
+            if (peak > threshold && !tWave) {
+                uint32_t peakIndex = locateRPeak();
+                if (!haveBeat || peakIndex > lastBeatIndex + REFRACTORY_SAMPLES) {
+                    acceptBeat(peakIndex, peak, candidateSlope, false);
+                    beat = true;
+                }
+            } else {
+                noisePeak = 0.125f * peak + 0.875f * noisePeak;
+                if (!tWave && peak > 0.5f * threshold && peak > searchBackValue) {
+                    searchBackValue = peak;
+                    searchBackSlope = candidateSlope;
+                    searchBackIndex = locateRPeak();
+                }
+            }
+        }
+    }
+    
+    // Search-back: no beat for 1.66 average R-R intervals, take the best
+    // candidate above half the threshold
+    if (!beat && haveBeat && rrCount > 0 && searchBackValue > 0.0f &&
+        index - lastBeatIndex > (uint32_t)(1.66f * rrSum / rrCount)) {
+        acceptBeat(searchBackIndex, searchBackValue, searchBackSlope, true);
+        beat = true;
+    }
+    
+    previousIntegrated[1] = previousIntegrated[0];
+    previousIntegrated[0] = integrated;
+    return beat;
+}
+
+uint32_t QrsDetector::locateRPeak() const {
+    // The R-peak is the largest input sample within the integrator window
+    // (plus filter delay) that produced the integrated peak
+    uint32_t current = sampleIndex - 1;
+    uint32_t best = current;
+    float bestValue = inputHistory[current & (HISTORY_SIZE - 1)];
+    int span = PEAK_SEARCH_WINDOW;
+    if ((uint32_t)span > current) {
+        span = current;
+    }
+    for (int i = 1; i <= span; i++) {
+        float candidate = inputHistory[(current - i) & (HISTORY_SIZE - 1)];
+        if (candidate > bestValue) {
+            bestValue = candidate;
+            best = current - i;
+        }
+    }
+    return best;
+}
+
+void QrsDetector::acceptBeat(uint32_t peakIndex, float peakValue, float slope, bool searchBack) {
+    // Search-back beats sat below the threshold, so SPKI adapts faster to them
+    if (searchBack) {
+        signalPeak = 0.25f * peakValue + 0.75f * signalPeak;
+    } else {
+        signalPeak = 0.125f * peakValue + 0.875f * signalPeak;
+    }
+    
+    lastRRInterval = 0;
+    if (haveBeat) {
+        uint32_t rr = peakIndex - lastBeatIndex;
+        lastRRInterval = rr > UINT16_MAX ? UINT16_MAX : rr;
+        
+        // Running average of the last RR_AVERAGE_COUNT intervals
+        if (rrCount == RR_AVERAGE_COUNT) {
+            rrSum -= rrHistory[rrIndex];
+        } else {
+            rrCount++;
+        }
+        rrHistory[rrIndex] = lastRRInterval;
+        rrSum += lastRRInterval;
+        rrIndex = (rrIndex + 1) % RR_AVERAGE_COUNT;
+    }
+    
+    lastBeatLag = sampleIndex - 1 - peakIndex;
+    lastBeatIndex = peakIndex;
+    lastQrsSlope = slope;
+    haveBeat = true;
+    searchBackValue = 0.0f;
+}
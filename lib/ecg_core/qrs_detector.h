@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include "ecg_config.h"
+#include "ecg_filters.h"
+
+// Streaming Pan-Tompkins QRS detector
+// Bandpass (5-15Hz), five-point derivative, squaring and a 150ms moving-window
+// integrator, followed by adaptive signal/noise peak thresholds with
+// refractory period, T-wave rejection and search-back. Every step is O(1) per
+// sample; the R-peak is located in a short input history once per beat.
+class QrsDetector {
+public:
+    QrsDetector();
+    // Processes one sample (volts); returns true when a beat is confirmed
+    bool update(float value);
+    // R-R interval of the confirmed beat in samples, 0 for the first beat
+    uint16_t rrInterval() const { return lastRRInterval; }
+    // How many samples before the current one the confirmed R-peak was
+    uint16_t beatLag() const { return lastBeatLag; }
+    void reset();
+
+private:
+    static const int INTEGRATION_WINDOW = SAMPLING_RATE * 150 / 1000;  // 150ms
+    static const int HISTORY_SIZE = 128;                               // Power of two, > search window
+    static const int PEAK_SEARCH_WINDOW = INTEGRATION_WINDOW + 16;     // Integrator + filter delay
+    static const int LEARNING_SAMPLES = 2 * SAMPLING_RATE;             // Threshold initialisation
+    static const int REFRACTORY_SAMPLES = SAMPLING_RATE * 200 / 1000;
+    static const int T_WAVE_WINDOW = SAMPLING_RATE * 360 / 1000;
+    static const int RR_AVERAGE_COUNT = 8;
+    
+    uint32_t locateRPeak() const;
+    void acceptBeat(uint32_t peakIndex, float peakValue, float slope, bool searchBack);
+    
+    Biquad highpass, lowpass;
+    float derivativeHistory[4];              // Previous bandpassed samples
+    float integratorWindow[INTEGRATION_WINDOW];
+    float integratorSum;
+    int integratorIndex;
+    float inputHistory[HISTORY_SIZE];       // For locating the R-peak
+    float previousIntegrated[2];
+    float maxSlope;                          // Largest |derivative| since the last candidate peak
+    
+    uint32_t sampleIndex;
+    float signalPeak;                        // SPKI
+    float noisePeak;                         // NPKI
+    float learningMax, learningSum;
+    uint32_t lastBeatIndex;                  // Sample index of the last R-peak
+    bool haveBeat;
+    float lastQrsSlope;
+    
+    // Best sub-threshold candidate since the last beat, for search-back
+    float searchBackValue;
+    float searchBackSlope;
+    uint32_t searchBackIndex;
+    
+    uint16_t rrHistory[RR_AVERAGE_COUNT];
+    uint32_t rrSum;
+    int rrCount, rrIndex;
+    
+    uint16_t lastRRInterval;
+    uint16_t lastBeatLag;
+};
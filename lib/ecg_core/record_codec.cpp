@@ -0,0 +1,64 @@
+#include "record_codec.h"
+
+bool RecordBlockEncoder::accepts(const EcgSample& sample) const {
+    // Blocks hold consecutive samples only
+    const RecordBlockHeader& header = current.header;
+    return header.sampleCount == 0 ||
+           (sample.sequence == header.sequence + header.sampleCount &&
+            header.payloadBytes + RECORD_MAX_VARINT_BYTES <= RECORD_PAYLOAD_SIZE);
+}
+
+void RecordBlockEncoder::add(const EcgSample& sample, uint32_t timestamp) {
+    RecordBlockHeader& header = current.header;
+    if (header.sampleCount == 0) {
+        header.magic = RECORD_BLOCK_MAGIC;
+        header.sequence = sample.sequence;
+        header.timestamp = timestamp;
+        header.firstSample = sample.filtered;
+        header.payloadBytes = 0;
+        header.flags = 0;
+        header.channel = 0;
+    } else {
+        // Zigzag maps small negative deltas to small unsigned values
+        int32_t delta = (int32_t)sample.filtered - previous;
+        uint32_t zigzag = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+        do {
+            uint8_t byte = zigzag & 0x7F;
+            zigzag >>= 7;
+            current.payload[header.payloadBytes++] = zigzag ? (byte | 0x80) : byte;
+        } while (zigzag);
+    }
+    previous = sample.filtered;
+    header.sampleCount++;
+}
+
+int decodeRecordBlock(const RecordBlock& block, int16_t* samples, int maxSamples) {
+    const RecordBlockHeader& header = block.header;
+    if (header.magic != RECORD_BLOCK_MAGIC || header.sampleCount > maxSamples ||
+        header.payloadBytes > RECORD_PAYLOAD_SIZE) {
+        return -1;
+    }
+    if (header.sampleCount == 0) {
+        return 0;
+    }
+    
+    int32_t value = header.firstSample;
+    samples[0] = value;
+    size_t offset = 0;
+    for (int i = 1; i < header.sampleCount; i++) {
+        uint32_t zigzag = 0;
+        int shift = 0;
+        uint8_t byte;
+        do {
+            if (offset >= header.payloadBytes || shift > 14) {
+                return -1;
+            }
+            byte = block.payload[offset++];
+            zigzag |= (uint32_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        value += (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+        samples[i] = value;
+    }
+    return header.sampleCount;
+}
@@ -0,0 +1,50 @@
+// Compact ECG record blocks
+// Fixed 256-byte blocks: a header with the first sample, then zigzag-encoded
+// deltas as LEB128 varints.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "ecg_config.h"
+
+const uint32_t RECORD_BLOCK_MAGIC = 0x31474345;          // "ECG1"
+const size_t RECORD_BLOCK_SIZE = 256;
+const uint8_t RECORD_FLAG_EVENT = 0x01;                  // An anomaly was reported in this block
+
+struct __attribute__((packed)) RecordBlockHeader {
+    uint32_t magic;
+    uint32_t sequence;      // Sequence number of the first sample
+    uint32_t timestamp;     // millis() when the first sample was recorded
+    int16_t firstSample;    // Filtered value of the first sample
+    uint16_t sampleCount;
+    uint16_t payloadBytes;  // Varint bytes used after the header
+    uint8_t flags;
+    uint8_t channel;        // ECG channel the samples come from
+};
+
+const size_t RECORD_PAYLOAD_SIZE = RECORD_BLOCK_SIZE - sizeof(RecordBlockHeader);
+const size_t RECORD_MAX_VARINT_BYTES = 3;                // Zigzag of a 16-bit delta fits 17 bits
+
+struct RecordBlock {
+    RecordBlockHeader header;
+    uint8_t payload[RECORD_PAYLOAD_SIZE];
+};
+static_assert(sizeof(RecordBlock) == RECORD_BLOCK_SIZE, "Record blocks must be exactly RECORD_BLOCK_SIZE");
+
+class RecordBlockEncoder {
+public:
+    bool empty() const { return current.header.sampleCount == 0; }
+    // False when the sample cannot join the current block: a sequence gap or
+    // a full payload. The block must be taken and cleared first.
+    bool accepts(const EcgSample& sample) const;
+    void add(const EcgSample& sample, uint32_t timestamp);
+    RecordBlock& block() { return current; }
+    void clear() { current.header.sampleCount = 0; }
+
+private:
+    RecordBlock current = {};
+    int16_t previous = 0;
+};
+
+// Decodes a block into samples; returns the sample count, or -1 if the block
+// is malformed or holds more than maxSamples
+int decodeRecordBlock(const RecordBlock& block, int16_t* samples, int maxSamples);
@@ -0,0 +1,197 @@
+// Sliding-window anomaly detection
+#pragma once
+#include <cmath>
+#include "ecg_config.h"
+
+// A new window starts every ANOMALY_HOP_SIZE samples, so consecutive windows
+// overlap by ECG_BUFFER_SIZE - ANOMALY_HOP_SIZE samples. Setting the hop to
+// ECG_BUFFER_SIZE gives back non-overlapping windows.
+const int ANOMALY_HOP_SIZE = 11;  // ~30ms at 360Hz
+const int WINDOWS_IN_FLIGHT = (ECG_BUFFER_SIZE + ANOMALY_HOP_SIZE - 1) / ANOMALY_HOP_SIZE;
+static_assert(ANOMALY_HOP_SIZE > 0 && ANOMALY_HOP_SIZE <= ECG_BUFFER_SIZE, "Invalid anomaly hop size");
+
+// Model is SVMModel, QuantizedSVMModel or RffModel. Interface for callers:
+//   bool addSample(float value)   adds one sample (volts); returns true when a
+//                                 window has just completed, in which case
+//                                 lastWindowAnomalous() holds its classification
+//   void reset()                  drops all partial windows, e.g. after a gap
+//   void setModel(const Model&)   switches models; partial windows are dropped
+//   void setThreshold(float)      decision boundary, as for isAnomalous()
+// Either way a window gets the same answer as the model's isAnomalous() on it.
+template <typename Model, bool Amortized = Model::piecewiseDistances>
+class SlidingAnomalyDetector;
+
+// Amortized scheduling, for models whose squared distances add up piecewise.
+// Overlapping windows share samples but pair them with different support
+// vector features, so no kernel term carries over from one window to the
+// next; what this saves is the burst of a full evaluation every hop. Each
+// window in flight keeps its squared distance to every support vector, and
+// its pre-filter dot product, and extends them by one hop's worth of terms
+// each time samples arrive. A completed window only has the cascade over the
+// kernel values left, through isAnomalousFromParts().
+template <typename Model>
+class SlidingAnomalyDetector<Model, true> {
+    static_assert(Model::numFeatures == ECG_BUFFER_SIZE, "Model feature count must match the ECG window size");
+
+public:
+    explicit SlidingAnomalyDetector(const Model& model) : model(&model) {}
+
+    bool addSample(float value) {
+        hop[hopFill++] = value;
+        if (hopFill < ANOMALY_HOP_SIZE) {
+            return false;
+        }
+        hopFill = 0;
+        return absorbHop();
+    }
+
+    bool lastWindowAnomalous() const { return lastAnomalous; }
+
+    void setModel(const Model& newModel) {
+        model = &newModel;
+        reset();
+    }
+
+    void setThreshold(float newThreshold) { threshold = newThreshold; }
+
+    void reset() {
+        hopFill = 0;
+        for (int w = 0; w < WINDOWS_IN_FLIGHT; w++) {
+            windows[w].active = false;
+        }
+    }
+
+private:
+    bool absorbHop() {
+        // The oldest slot finished on the previous hop, start the next window in it
+        WindowState& started = windows[nextWindow];
+        started.active = true;
+        started.filled = 0;
+        started.prefilterDot = 0.0f;
+        for (int k = 0; k < model->numSupportVectors; k++) {
+            started.squaredDistances[k] = 0.0f;
+        }
+        nextWindow = (nextWindow + 1) % WINDOWS_IN_FLIGHT;
+
+        bool completed = false;
+        for (int w = 0; w < WINDOWS_IN_FLIGHT; w++) {
+            WindowState& window = windows[w];
+            if (!window.active) {
+                continue;
+            }
+
+            // The hop lands at positions [filled, filled + count) of this window,
+            // standardize it for those positions
+            int count = ECG_BUFFER_SIZE - window.filled;
+            if (count > ANOMALY_HOP_SIZE) {
+                count = ANOMALY_HOP_SIZE;
+            }
+            for (int j = 0; j < count; j++) {
+                standardizedHop[j] = model->standardize(hop[j], window.filled + j);
+            }
+
+            // Extend the pre-filter score and each support vector's squared
+            // distance by the new terms
+            if (model->prefilterWeights != nullptr) {
+                for (int j = 0; j < count; j++) {
+                    window.prefilterDot += standardizedHop[j] * model->prefilterWeights[window.filled + j];
+                }
+            }
+            for (int k = 0; k < model->numSupportVectors; k++) {
+                const float* supportVector = &model->supportVectors[k * model->numFeatures + window.filled];
+                float partial = 0.0f;
+                for (int j = 0; j < count; j++) {
+                    float diff = standardizedHop[j] - supportVector[j];
+                    partial += diff * diff;
+                }
+                window.squaredDistances[k] += partial;
+            }
+
+            window.filled += count;
+            if (window.filled == ECG_BUFFER_SIZE) {
+                // Window complete: only the kernel evaluations are left
+                lastAnomalous = model->isAnomalousFromParts(window.prefilterDot, window.squaredDistances, threshold);
+                window.active = false;
+                completed = true;
+            }
+        }
+        return completed;
+    }
+
+    struct WindowState {
+        bool active;
+        int filled;  // Samples absorbed so far
+        float prefilterDot;
+        float squaredDistances[Model::maxSupportVectors];
+    };
+
+    const Model* model;
+    float hop[ANOMALY_HOP_SIZE];
+    float standardizedHop[ANOMALY_HOP_SIZE];
+    int hopFill = 0;
+    bool lastAnomalous = false;
+    float threshold = 0.0f;
+    WindowState windows[WINDOWS_IN_FLIGHT] = {};
+    int nextWindow = 0;
+};
+
+// Other models: keep the raw history and evaluate the whole window at every hop
+template <typename Model>
+class SlidingAnomalyDetector<Model, false> {
+    static_assert(Model::numFeatures == ECG_BUFFER_SIZE, "Model feature count must match the ECG window size");
+
+public:
+    explicit SlidingAnomalyDetector(const Model& model) : model(&model) {}
+
+    bool addSample(float value) {
+        hop[hopFill++] = value;
+        if (hopFill < ANOMALY_HOP_SIZE) {
+            return false;
+        }
+        hopFill = 0;
+        return absorbHop();
+    }
+
+    bool lastWindowAnomalous() const { return lastAnomalous; }
+
+    void setModel(const Model& newModel) {
+        model = &newModel;
+        reset();
+    }
+
+    void setThreshold(float newThreshold) { threshold = newThreshold; }
+
+    void reset() {
+        hopFill = 0;
+        historyCount = 0;
+    }
+
+private:
+    bool absorbHop() {
+        for (int j = 0; j < ANOMALY_HOP_SIZE; j++) {
+            history[historyIndex] = hop[j];
+            historyIndex = (historyIndex + 1) % ECG_BUFFER_SIZE;
+        }
+        historyCount += ANOMALY_HOP_SIZE;
+        if (historyCount < ECG_BUFFER_SIZE) {
+            return false;
+        }
+        historyCount = ECG_BUFFER_SIZE;
+
+        for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+            standardizedWindow[i] = model->standardize(history[(historyIndex + i) % ECG_BUFFER_SIZE], i);
+        }
+        lastAnomalous = model->isAnomalous(standardizedWindow, threshold);
+        return true;
+    }
+
+    const Model* model;
+    float hop[ANOMALY_HOP_SIZE];
+    int hopFill = 0;
+    bool lastAnomalous = false;
+    float threshold = 0.0f;
+    float history[ECG_BUFFER_SIZE] = {0};
+    int historyIndex = 0;
+    int historyCount = 0;
+    alignas(16) float standardizedWindow[ECG_BUFFER_SIZE];
+};
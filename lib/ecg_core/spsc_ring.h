@@ -0,0 +1,41 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// Lock-free single-producer/single-consumer ring buffer
+// One task is the only writer and another the only reader, so head and tail
+// each have exactly one owner and need no lock.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    bool push(const T& item) {
+        size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead - tail.load(std::memory_order_acquire) == Capacity) {
+            return false;  // Full
+        }
+        items[currentHead & (Capacity - 1)] = item;
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+    
+    bool pop(T& item) {
+        size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == currentTail) {
+            return false;  // Empty
+        }
+        item = items[currentTail & (Capacity - 1)];
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+    
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+private:
+    T items[Capacity];
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+};
@@ -0,0 +1,411 @@
+// SVM inference engines
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+// RBF kernel backend: esp-dsp dot products (PIE SIMD on ESP32-S3, tuned
+// assembly on ESP32) when the library is available, portable scalar otherwise
+#ifndef SVM_USE_ESP_DSP
+#if __has_include(<esp_dsp.h>)
+#define SVM_USE_ESP_DSP 1
+#else
+#define SVM_USE_ESP_DSP 0
+#endif
+#endif
+
+#if SVM_USE_ESP_DSP
+#include <esp_dsp.h>
+#endif
+
+inline float dotProduct(const float* x1, const float* x2, int length) {
+#if SVM_USE_ESP_DSP
+    float result = 0.0f;
+    dsps_dotprod_f32(x1, x2, &result, length);
+    return result;
+#else
+    float result = 0.0f;
+    for (int i = 0; i < length; i++) {
+        result += x1[i] * x2[i];
+    }
+    return result;
+#endif
+}
+
+// ||x-y||^2 summed element by element: exact to float rounding whatever the
+// norms are, and the form the portable backend uses
+inline float squaredDistanceDirect(const float* x, const float* sv, int length) {
+    float squaredDistance = 0.0f;
+    for (int i = 0; i < length; i++) {
+        float diff = x[i] - sv[i];
+        squaredDistance += diff * diff;
+    }
+    return squaredDistance;
+}
+
+// ||x-y||^2 = ||x||^2 + ||y||^2 - 2 x.y: one dot product per support vector,
+// which esp-dsp vectorizes. Cancellation costs precision when the norms are
+// large next to the distance (the bench measures it), and rounding can push
+// it slightly negative.
+inline float squaredDistanceExpanded(const float* x, float xSqNorm, const float* sv, float svSqNorm, int length) {
+    float squaredDistance = xSqNorm + svSqNorm - 2.0f * dotProduct(x, sv, length);
+    return squaredDistance < 0.0f ? 0.0f : squaredDistance;
+}
+
+// Calculate RBF kernel: K(x,y) = exp(-gamma * ||x-y||^2)
+// The norms are only used with esp-dsp; the scalar loop is as fast either way.
+inline float rbfKernel(const float* x, [[maybe_unused]] float xSqNorm, const float* sv,
+                       [[maybe_unused]] float svSqNorm, int length, float gamma) {
+#if SVM_USE_ESP_DSP
+    float squaredDistance = squaredDistanceExpanded(x, xSqNorm, sv, svSqNorm, length);
+#else
+    float squaredDistance = squaredDistanceDirect(x, sv, length);
+#endif
+    return expf(-gamma * squaredDistance);
+}
+
+// Largest number of windows classified in one isAnomalousBatch() call
+const int SVM_MAX_BATCH = 8;
+
+// SVM model parameters
+// A view over tables that stay where they are: the flash arrays generated by
+// svm-extraction.py into svm_model_params.h, or a model file mapped from flash
+// (model_format.h). No heap is used for the support vectors. The feature
+// count is fixed by the window size; the support vector count may vary per
+// model up to MaxSupportVectors, which sizes per-support-vector state
+// elsewhere (e.g. the sliding detector).
+template <int MaxSupportVectors, int NumFeatures>
+struct SVMModel {
+    static constexpr int maxSupportVectors = MaxSupportVectors;
+    static constexpr int numFeatures = NumFeatures;
+    static constexpr bool piecewiseDistances = true;  // Squared distances can be accumulated piecewise
+    int numSupportVectors;
+    float gamma;  // RBF kernel parameter
+    float bias;
+    const float* supportVectors;  // Flattened support vectors
+    const float* dualCoefficients;
+    const float* featureMeans;
+    const float* featureInverseStds;  // 1 / std, so standardizing needs no division
+    const float* supportVectorSqNorms;  // ||sv||^2 for the dot-product kernel
+    // Cascade: sums of the positive and of the negative coefficients from
+    // support vector i to the end (numSupportVectors + 1 entries), nullptr to
+    // always evaluate every support vector
+    const float* remainingPositive;
+    const float* remainingNegative;
+    // Linear pre-filter: windows with prefilterWeights.x + prefilterBias above
+    // prefilterThreshold are normal; nullptr disables it
+    const float* prefilterWeights;
+    float prefilterBias;
+    float prefilterThreshold;
+
+    float standardize(float value, int featureIndex) const {
+        // Apply same standardization as used during training
+        return (value - featureMeans[featureIndex]) * featureInverseStds[featureIndex];
+    }
+
+    // Decision units per unit of the float SVM decision
+    float decisionScale() const { return 1.0f; }
+
+    // features must already be standardized (same as in training)
+    float decision(const float* features) const {
+        // SVM prediction with RBF kernel
+        float result = bias;
+
+        // ||x||^2 is shared by every support vector, compute it once per window
+        float featureSqNorm = dotProduct(features, features, numFeatures);
+
+        // For each support vector, compare directly against the flattened table
+        for (int i = 0; i < numSupportVectors; i++) {
+            const float* supportVector = &supportVectors[i * numFeatures];
+
+            // Calculate kernel and add weighted contribution
+            float kernelValue = rbfKernel(features, featureSqNorm, supportVector,
+                                          supportVectorSqNorms[i], numFeatures, gamma);
+            result += dualCoefficients[i] * kernelValue;
+        }
+        return result;
+    }
+
+    // Decision boundary: decision < threshold means anomaly, threshold 0 is
+    // the model's own. The cascade gives the same answer as
+    // decision(features) < threshold but usually stops early: support vectors
+    // are sorted by decreasing |alpha| and every kernel value lies in (0, 1],
+    // so the rest of the sum is bounded by the remaining coefficient sums.
+    // The linear pre-filter, when the model has one, is not exact: it reports
+    // "normal" without evaluating the SVM, and may do so for a window the SVM
+    // would flag, at the rate svm-extraction.py --validation-data reports (the
+    // bench counts these too). threshold must not be positive, since the
+    // pre-filter threshold was fitted for the model's own boundary.
+    bool isAnomalous(const float* features, float threshold = 0.0f) const {
+        if (prefilterWeights != nullptr &&
+            dotProduct(features, prefilterWeights, numFeatures) + prefilterBias > prefilterThreshold) {
+            return false;
+        }
+        float featureSqNorm = dotProduct(features, features, numFeatures);
+        return classify(threshold, [&](int i) {
+            return rbfKernel(features, featureSqNorm, &supportVectors[i * numFeatures], supportVectorSqNorms[i],
+                             numFeatures, gamma);
+        });
+    }
+
+    // Same classification as isAnomalous() from parts accumulated elsewhere,
+    // as the sliding detector does: prefilterDot is prefilterWeights.x
+    // (ignored without a pre-filter) and squaredDistances holds ||x - sv||^2
+    // for every support vector
+    bool isAnomalousFromParts(float prefilterDot, const float* squaredDistances, float threshold = 0.0f) const {
+        if (prefilterWeights != nullptr && prefilterDot + prefilterBias > prefilterThreshold) {
+            return false;
+        }
+        return classify(threshold, [&](int i) { return expf(-gamma * squaredDistances[i]); });
+    }
+
+    // Cascade over the support vectors; kernel(i) gives K(x, sv_i)
+    template <typename Kernel>
+    bool classify(float threshold, Kernel kernel) const {
+        float result = bias - threshold;
+        for (int i = 0; i < numSupportVectors; i++) {
+            if (remainingPositive != nullptr) {
+                if (result + remainingNegative[i] >= 0) {
+                    return false;  // Cannot drop below zero any more
+                }
+                if (result + remainingPositive[i] < 0) {
+                    return true;   // Cannot reach zero any more
+                }
+            }
+            result += dualCoefficients[i] * kernel(i);
+        }
+        return result < 0;
+    }
+
+    // Classifies count (<= SVM_MAX_BATCH) windows in one pass over the support
+    // vectors, so each one is read from flash once per batch instead of once
+    // per window. Same pre-filter, early exits and results as isAnomalous().
+    // thresholds, if given, moves each window's boundary to decision <
+    // thresholds[b]; they must not be positive, or the pre-filter could clear
+    // windows the SVM would flag.
+    void isAnomalousBatch(const float* const* windows, int count, bool* anomalous,
+                          const float* thresholds = nullptr) const {
+        float result[SVM_MAX_BATCH];
+        float featureSqNorms[SVM_MAX_BATCH];
+        bool settled[SVM_MAX_BATCH];
+        int pending = 0;
+        for (int b = 0; b < count; b++) {
+            settled[b] = prefilterWeights != nullptr &&
+                         dotProduct(windows[b], prefilterWeights, numFeatures) + prefilterBias > prefilterThreshold;
+            anomalous[b] = false;
+            result[b] = bias - (thresholds != nullptr ? thresholds[b] : 0.0f);
+            featureSqNorms[b] = dotProduct(windows[b], windows[b], numFeatures);
+            pending += !settled[b];
+        }
+
+        for (int i = 0; i < numSupportVectors && pending > 0; i++) {
+            const float* supportVector = &supportVectors[i * numFeatures];
+            for (int b = 0; b < count; b++) {
+                if (settled[b]) {
+                    continue;
+                }
+                if (remainingPositive != nullptr &&
+                    (result[b] + remainingNegative[i] >= 0 || result[b] + remainingPositive[i] < 0)) {
+                    anomalous[b] = result[b] + remainingNegative[i] < 0;
+                    settled[b] = true;
+                    pending--;
+                    continue;
+                }
+                float kernelValue = rbfKernel(windows[b], featureSqNorms[b], supportVector,
+                                              supportVectorSqNorms[i], numFeatures, gamma);
+                result[b] += dualCoefficients[i] * kernelValue;
+            }
+        }
+        for (int b = 0; b < count; b++) {
+            if (!settled[b]) {
+                anomalous[b] = result[b] < 0;
+            }
+        }
+    }
+};
+
+// Suffix sums for the SVMModel cascade, for models whose file does not carry
+// them; each table has count + 1 entries
+inline void computeCascadeBounds(const float* dualCoefficients, int count, float* remainingPositive,
+                                 float* remainingNegative) {
+    remainingPositive[count] = 0.0f;
+    remainingNegative[count] = 0.0f;
+    for (int i = count - 1; i >= 0; i--) {
+        float coefficient = dualCoefficients[i];
+        remainingPositive[i] = remainingPositive[i + 1] + (coefficient > 0 ? coefficient : 0.0f);
+        remainingNegative[i] = remainingNegative[i + 1] + (coefficient < 0 ? coefficient : 0.0f);
+    }
+}
+
+// 1 / std for model files, which store the scaler's standard deviations
+inline void computeInverseStds(const float* featureStds, int count, float* featureInverseStds) {
+    for (int i = 0; i < count; i++) {
+        featureInverseStds[i] = 1.0f / featureStds[i];
+    }
+}
+
+// Fixed-point SVM model
+// Support vectors are int8/int16 with per-feature scales, squared distances are
+// accumulated in integers and exp() comes from a Q15 table. The arithmetic
+// matches quantized_decision() in svm-extraction.py.
+template <typename QuantizedValue, int NumSupportVectors, int NumFeatures>
+struct QuantizedSVMModel {
+    static constexpr int numSupportVectors = NumSupportVectors;
+    static constexpr int maxSupportVectors = NumSupportVectors;
+    static constexpr int numFeatures = NumFeatures;
+    static constexpr bool piecewiseDistances = false;
+    // int8 products fit a 32-bit accumulator after productShift, int16 need 64 bits
+    typedef typename std::conditional<sizeof(QuantizedValue) == 1, uint32_t, uint64_t>::type Accumulator;
+    float kernelScale;  // gamma * squared distance per accumulator unit
+    int64_t bias;       // Bias in decision accumulator units
+    float decisionUnit; // Accumulator units per unit of the float decision
+    int quantMax;       // Largest quantized magnitude
+    int productShift;   // Right shift applied to each weighted product
+    int expLutSize;
+    int expLutResolution;                  // Table entries per unit of gamma * distance
+    const QuantizedValue* supportVectors;  // Flattened support vectors
+    const int16_t* dualCoefficients;       // Q15 of the largest |alpha|
+    const uint16_t* featureWeights;        // Per-feature distance weights, Q15
+    const float* inputScales;              // Standardized value -> quantized value
+    const uint16_t* expTable;              // exp(-t) in Q15
+    const float* featureMeans;
+    const float* featureInverseStds;
+
+    float standardize(float value, int featureIndex) const {
+        return (value - featureMeans[featureIndex]) * featureInverseStds[featureIndex];
+    }
+
+    float decisionScale() const { return decisionUnit; }
+
+    int64_t decision(const float* features) const {
+        QuantizedValue quantized[NumFeatures];
+        quantize(features, quantized);
+
+        int64_t result = bias;
+        for (int i = 0; i < numSupportVectors; i++) {
+            const QuantizedValue* supportVector = &supportVectors[i * numFeatures];
+            result += (int32_t)dualCoefficients[i] * kernel(weightedDistance(quantized, supportVector) * kernelScale);
+        }
+        return result;
+    }
+
+    void quantize(const float* features, QuantizedValue* quantized) const {
+        // Quantize the standardized window with the per-feature scales
+        for (int j = 0; j < numFeatures; j++) {
+            long value = lroundf(features[j] * inputScales[j]);
+            if (value > quantMax) {
+                value = quantMax;
+            } else if (value < -quantMax) {
+                value = -quantMax;
+            }
+            quantized[j] = value;
+        }
+    }
+
+    Accumulator weightedDistance(const QuantizedValue* quantized, const QuantizedValue* supportVector) const {
+        // Weighted squared distance, integer only
+        Accumulator distance = 0;
+        for (int j = 0; j < numFeatures; j++) {
+            int32_t diff = (int32_t)quantized[j] - supportVector[j];
+            uint32_t squared = (uint32_t)(diff < 0 ? -diff : diff);
+            squared *= squared;
+            distance += ((Accumulator)featureWeights[j] * squared) >> productShift;
+        }
+        return distance;
+    }
+
+    int32_t kernel(float t) const {
+        // exp(-t) in Q15 by linear interpolation in the lookup table
+        if (t >= (float)expLutSize / expLutResolution) {
+            return 0;
+        }
+        uint32_t position = (uint32_t)(t * (expLutResolution * 256));  // Q8 table index
+        uint32_t index = position >> 8;
+        int32_t fraction = position & 255;
+        return expTable[index] + ((((int32_t)expTable[index + 1] - expTable[index]) * fraction) >> 8);
+    }
+
+    bool isAnomalous(const float* features, float threshold = 0.0f) const {
+        return decision(features) < llroundf(threshold);
+    }
+
+    // Classifies count (<= SVM_MAX_BATCH) windows with one pass over the support
+    // vectors; thresholds, if given, are per-window boundaries in decision units
+    void isAnomalousBatch(const float* const* windows, int count, bool* anomalous,
+                          const float* thresholds = nullptr) const {
+        QuantizedValue quantized[SVM_MAX_BATCH][NumFeatures];
+        int64_t result[SVM_MAX_BATCH];
+        for (int b = 0; b < count; b++) {
+            quantize(windows[b], quantized[b]);
+            result[b] = bias - (thresholds != nullptr ? llroundf(thresholds[b]) : 0);
+        }
+        for (int i = 0; i < numSupportVectors; i++) {
+            const QuantizedValue* supportVector = &supportVectors[i * numFeatures];
+            for (int b = 0; b < count; b++) {
+                result[b] += (int32_t)dualCoefficients[i] *
+                             kernel(weightedDistance(quantized[b], supportVector) * kernelScale);
+            }
+        }
+        for (int b = 0; b < count; b++) {
+            anomalous[b] = result[b] < 0;
+        }
+    }
+};
+
+// Random Fourier feature model
+// exp(-gamma ||x - y||^2) ~= z(x).z(y) with z(x) = sqrt(2/D) cos(Wx + b),
+// W ~ N(0, 2 gamma I) and b ~ U[0, 2pi), so the whole kernel expansion turns
+// into one linear function of z(x). svm-extraction.py --rff draws W and b and
+// fits the weights (sqrt(2/D) folded in). A decision costs D dot products of
+// the window and D cosines, however many support vectors the SVM had.
+template <int NumComponents, int NumFeatures>
+struct RffModel {
+    static constexpr int numComponents = NumComponents;
+    static constexpr int numFeatures = NumFeatures;
+    static constexpr bool piecewiseDistances = false;
+    float bias;
+    const float* projection;  // W, NumComponents rows of NumFeatures
+    const float* phases;      // b
+    const float* weights;     // Linear classifier over z(x)
+    const float* featureMeans;
+    const float* featureInverseStds;
+
+    float standardize(float value, int featureIndex) const {
+        return (value - featureMeans[featureIndex]) * featureInverseStds[featureIndex];
+    }
+
+    // Fitted to the float decision, so in the same units
+    float decisionScale() const { return 1.0f; }
+
+    float decision(const float* features) const {
+        float result = bias;
+        for (int d = 0; d < numComponents; d++) {
+            float projected = dotProduct(features, &projection[d * numFeatures], numFeatures) + phases[d];
+            result += weights[d] * cosf(projected);
+        }
+        return result;
+    }
+
+    bool isAnomalous(const float* features, float threshold = 0.0f) const {
+        return decision(features) < threshold;
+    }
+
+    // Classifies count (<= SVM_MAX_BATCH) windows with one pass over the
+    // projection; thresholds, if given, are per-window decision boundaries
+    void isAnomalousBatch(const float* const* windows, int count, bool* anomalous,
+                          const float* thresholds = nullptr) const {
+        float result[SVM_MAX_BATCH];
+        for (int b = 0; b < count; b++) {
+            result[b] = bias - (thresholds != nullptr ? thresholds[b] : 0.0f);
+        }
+        for (int d = 0; d < numComponents; d++) {
+            const float* row = &projection[d * numFeatures];
+            for (int b = 0; b < count; b++) {
+                result[b] += weights[d] * cosf(dotProduct(windows[b], row, numFeatures) + phases[d]);
+            }
+        }
+        for (int b = 0; b < count; b++) {
+            anomalous[b] = result[b] < 0;
+        }
+    }
+};
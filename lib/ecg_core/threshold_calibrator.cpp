@@ -0,0 +1,53 @@
+#include "threshold_calibrator.h"
+#include <cmath>
+
+void ThresholdCalibrator::reset() {
+    decisions = 0;
+    anomalous = 0;
+    mean = 0.0;
+    m2 = 0.0;
+}
+
+void ThresholdCalibrator::add(double decision) {
+    decisions++;
+    double delta = decision - mean;
+    mean += delta / decisions;
+    m2 += delta * (decision - mean);
+    anomalous += decision < 0;
+}
+
+float ThresholdCalibrator::anomalousShare() const {
+    if (decisions == 0) {
+        return 0.0f;
+    }
+    return (float)anomalous / decisions;
+}
+
+float ThresholdCalibrator::deviation() const {
+    if (decisions < 2) {
+        return 0.0f;
+    }
+    return (float)std::sqrt(m2 / (decisions - 1));
+}
+
+bool ThresholdCalibrator::accepted() const {
+    return decisions >= 2 && anomalousShare() <= MAX_ANOMALOUS_SHARE;
+}
+
+float ThresholdCalibrator::threshold() const {
+    if (decisions < 2) {
+        return 0.0f;
+    }
+    float spread = deviation();
+    if (spread > MAX_DEVIATION) {
+        spread = MAX_DEVIATION;
+    }
+    float boundary = (float)mean - DECISION_SIGMAS * spread;
+    if (boundary > 0.0f) {
+        return 0.0f;
+    }
+    if (boundary < -MAX_THRESHOLD_SHIFT) {
+        return -MAX_THRESHOLD_SHIFT;
+    }
+    return boundary;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+// Per-patient decision threshold from the decisions of normal beats
+// Decisions are in units of the float SVM decision, where the margin lies at
+// +-1; engines with other units divide by their decisionScale() first. The
+// threshold sits DECISION_SIGMAS deviations below the mean decision and is
+// bounded both ways: never above 0, so calibration only removes false alarms,
+// and never below -MAX_THRESHOLD_SHIFT, so a session with widely spread
+// decisions cannot move the boundary out of reach of real anomalies. The
+// deviation is capped as well, and sessions in which more than
+// MAX_ANOMALOUS_SHARE of the beats are already anomalous are rejected: the
+// patient is not in normal rhythm, and calibrating would hide their alarms.
+class ThresholdCalibrator {
+public:
+    static constexpr float DECISION_SIGMAS = 3.0f;
+    static constexpr float MAX_DEVIATION = 0.25f;        // A quarter of the margin
+    static constexpr float MAX_THRESHOLD_SHIFT = 0.5f;   // Half the margin
+    static constexpr float MAX_ANOMALOUS_SHARE = 0.15f;
+
+    ThresholdCalibrator() { reset(); }
+    void reset();
+    void add(double decision);
+
+    int count() const { return decisions; }
+    float anomalousShare() const;   // Share of decisions below 0
+    float deviation() const;        // Sample standard deviation, uncapped
+    bool accepted() const;
+    // In [-MAX_THRESHOLD_SHIFT, 0]; 0 without enough decisions
+    float threshold() const;
+
+private:
+    int decisions;
+    int anomalous;
+    double mean;
+    double m2;                      // Welford sum of squared deviations
+};
@@ -2,44 +2,108 @@
  * ESP32 ECG Monitoring System with SVM Anomaly Detection
  * 
  * Features:
- * - Reads ECG data from AD8232 sensor
+ * - Reads ECG data from one or more AD8232 sensors using hardware-timed ADC DMA sampling
  * - Processes data in 30ms windows
- * - Detects anomalies using SVM with RBF kernel
+ * - Detects anomalies using SVM with RBF kernel, hot-swappable over HTTP,
+ *   batching the windows of all channels into one pass over the model
+ * - Calibrates normalization and decision boundary per patient, kept in NVS
  * - Calculates calories based on heart rate
+ * - Tracks heart rate variability (SDNN, RMSSD, pNN50) and rhythm irregularity
  * - Activates buzzer on anomaly detection
+ * - Records the filtered ECG to flash, with captures around each anomaly
+ * - Uploads the recording in batches to a remote collector over HTTPS
+ * - Profiles the hot path in CPU cycles and exports it on /metrics
+ * - Event-driven tasks with frequency scaling and light sleep between blocks
  * - Provides web interface with WebSockets for real-time monitoring
  ******************************************************************/
 
 #include <Arduino.h>
 #include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
 #include <ESPAsyncWebServer.h>
 #include <SPIFFS.h>
+#include <Preferences.h>
 #include <ArduinoJson.h>
 #include <Ticker.h>
-#include <vector>
+#include <esp_adc/adc_continuous.h>
+#include <esp_cpu.h>
+#include <esp_heap_caps.h>
+#include <esp_partition.h>
+#include <esp_pm.h>
+#include <atomic>
+#include <memory>
 #include <cmath>
+#include <cstdarg>
+#include "ecg_config.h"
+#include "spsc_ring.h"
+#include "ecg_filters.h"
+#include "qrs_detector.h"
+#include "beat_segmenter.h"
+#include "svm_engine.h"
+#include "sliding_detector.h"
+#include "record_codec.h"
+#include "cycle_histogram.h"
+#include "hrv_stats.h"
+#include "threshold_calibrator.h"
+#include "model_format.h"
+#include "svm_model_params.h"
+
+// Inference engine, selected at compile time
+#define SVM_ENGINE_FLOAT 0      // Float SVMModel (default)
+#define SVM_ENGINE_QUANTIZED 1  // Fixed-point tables from svm-extraction.py --quantize
+#define SVM_ENGINE_RFF 2        // Random Fourier features from svm-extraction.py --rff
+#ifndef SVM_ENGINE
+#define SVM_ENGINE SVM_ENGINE_FLOAT
+#endif
+
+#if SVM_ENGINE == SVM_ENGINE_QUANTIZED
+#include "svm_model_quantized.h"
+#elif SVM_ENGINE == SVM_ENGINE_RFF
+#include "svm_model_rff.h"
+#endif
 
 // Network credentials
 const char* ssid = "YOUR_WIFI_SSID";
 const char* password = "YOUR_WIFI_PASSWORD";
 
+// Collector that recordings are uploaded to, leave empty to disable uploads
+const char* collectorUrl = "";            // e.g. "https://collector.example.com/ecg"
+const char* collectorCaCert = nullptr;    // PEM root certificate of the collector's chain
+
+// WiFi runs in the background: monitoring starts at boot whether or not the
+// network is up, the web server starts on the first IP address, and every
+// disconnect schedules a reconnect. Until then the ECG is only recorded to flash.
+const uint32_t WIFI_RECONNECT_DELAY_MS = 2000;
+Ticker wifiReconnectTimer;
+bool webServerStarted = false;            // Only touched by the WiFi event task
+
+// ECG channels
+// One AD8232 per channel, each monitoring its own patient with its own signal
+// chain; build with -DECG_CHANNEL_COUNT=N to serve up to MAX_ECG_CHANNELS.
+#ifndef ECG_CHANNEL_COUNT
+#define ECG_CHANNEL_COUNT 1
+#endif
+const int MAX_ECG_CHANNELS = 4;
+static_assert(ECG_CHANNEL_COUNT >= 1 && ECG_CHANNEL_COUNT <= MAX_ECG_CHANNELS, "Unsupported ECG channel count");
+
 // Pin definitions
-const int ECG_PIN = 34;      // AD8232 ECG sensor output
-const int LO_PLUS_PIN = 32;  // AD8232 LO+ pin
-const int LO_MINUS_PIN = 33; // AD8232 LO- pin
-const int BUZZER_PIN = 25;   // Buzzer pin
-
-// ECG and heart rate variables
-const int ECG_BUFFER_SIZE = 140;              // Size of our feature vector
-const int SAMPLING_RATE = 360;                // Sampling rate in Hz
-const unsigned long SAMPLE_INTERVAL = 1000000 / SAMPLING_RATE; // Microseconds between samples
-std::vector<float> ecgBuffer(ECG_BUFFER_SIZE, 0.0);
-unsigned long lastSampleTime = 0;
-int bufferIndex = 0;
-float heartRate = 0.0;
-float dailyCalories = 0.0;
-bool anomalyDetected = false;
-unsigned long lastAnomalyTime = 0;
+struct EcgChannelPins {
+    int ecg;      // AD8232 ECG sensor output, must be an ADC1 pin
+    int loPlus;   // AD8232 LO+ pin
+    int loMinus;  // AD8232 LO- pin
+};
+const EcgChannelPins ECG_CHANNEL_PINS[MAX_ECG_CHANNELS] = {
+    {34, 32, 33},
+    {35, 26, 27},
+    {36, 16, 17},
+    {39, 18, 19},
+};
+const int BUZZER_PIN = 25;   // Buzzer pin, shared by all channels
+
+// Alert state; heart rate and calories are kept per channel
+bool anomalyDetected = false;   // Buzzer is on
+unsigned long lastBuzzerTime = 0;
 const unsigned long BUZZER_DURATION = 500;    // Buzzer duration in ms
 const unsigned long ANOMALY_COOLDOWN = 3000;  // Time between consecutive anomaly alerts
 
@@ -48,151 +112,1480 @@ unsigned long startTime = 0;
 unsigned long lastCalorieUpdate = 0;
 const unsigned long CALORIE_UPDATE_INTERVAL = 60000; // Update calories every minute
 
-// SVM model parameters
-// These would be extracted from the trained model
-struct SVMModel {
-    int numSupportVectors;
-    float gamma;  // RBF kernel parameter
-    float bias;
-    std::vector<float> supportVectors;  // Flattened support vectors
-    std::vector<float> dualCoefficients;
-    std::vector<float> featureMeans;
-    std::vector<float> featureStds;
-} svmModel;
+// ADC sampling engine
+// The ADC runs in continuous (DMA) mode at an oversampled rate and every
+// ADC_OVERSAMPLING conversions are averaged into one ECG sample, so the
+// 360 Hz sample clock comes from hardware instead of loop() timing.
+// The continuous driver cannot run as slow as 360 Hz, hence the oversampling.
+// With several channels the conversion pattern cycles through their inputs,
+// so the converter runs ECG_CHANNEL_COUNT times faster.
+const int ADC_OVERSAMPLING = 64;
+const uint32_t ADC_SAMPLE_FREQ = (uint32_t)SAMPLING_RATE * ADC_OVERSAMPLING * ECG_CHANNEL_COUNT; // 23040 Hz per channel
+const int SAMPLE_BLOCK_SIZE = 12;             // ECG samples per channel per DMA frame (~33ms)
+const uint32_t ADC_FRAME_BYTES = SAMPLE_BLOCK_SIZE * ADC_OVERSAMPLING * ECG_CHANNEL_COUNT * SOC_ADC_DIGI_RESULT_BYTES;
+const uint32_t ADC_POOL_BYTES = ADC_FRAME_BYTES * 8; // DMA ring holds ~270ms of data
+static_assert(ADC_SAMPLE_FREQ >= SOC_ADC_SAMPLE_FREQ_THRES_LOW, "ADC sample rate below driver minimum");
+static_assert(ADC_SAMPLE_FREQ <= SOC_ADC_SAMPLE_FREQ_THRES_HIGH, "ADC sample rate above driver maximum");
+
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#define ADC_OUTPUT_TYPE ADC_DIGI_OUTPUT_FORMAT_TYPE1
+#define ADC_GET_CHANNEL(p) ((p)->type1.channel)
+#define ADC_GET_DATA(p) ((p)->type1.data)
+#else
+#define ADC_OUTPUT_TYPE ADC_DIGI_OUTPUT_FORMAT_TYPE2
+#define ADC_GET_CHANNEL(p) ((p)->type2.channel)
+#define ADC_GET_DATA(p) ((p)->type2.data)
+#endif
+
+adc_continuous_handle_t adcHandle = nullptr;
+uint8_t adcFrame[ADC_FRAME_BYTES];
+
+// Task layout
+// Acquisition is pinned to the application core at high priority so SVM
+// evaluation and WebSocket fan-out on the protocol core cannot delay it.
+const BaseType_t ACQUISITION_CORE = APP_CPU_NUM;
+const BaseType_t PROCESSING_CORE = PRO_CPU_NUM;
+const UBaseType_t ACQUISITION_PRIORITY = configMAX_PRIORITIES - 2;
+const UBaseType_t PROCESSING_PRIORITY = 2;
+const uint32_t ACQUISITION_STACK_SIZE = 4096;
+const uint32_t PROCESSING_STACK_SIZE = 8192;
+const uint32_t ADC_READ_TIMEOUT_MS = 100;
+const uint32_t PROCESSING_IDLE_WAKE_MS = 1000;   // Wake for timers and lead polling without samples
+const size_t SAMPLE_RING_SIZE = 1024;            // ~2.8s of samples at 360Hz, per channel
+
+TaskHandle_t acquisitionTaskHandle = nullptr;
+TaskHandle_t processingTaskHandle = nullptr;
+std::atomic<uint32_t> droppedSamples{0};      // Samples lost because a ring was full
+
+// Acquisition side of a channel: decimator and real-time signal chain, used
+// by the acquisition task only, and the ring to the processing task
+struct AcquisitionChannel {
+    adc_channel_t adcChannel;
+    uint32_t decimatorSum;    // Running sum of raw conversions for the current sample
+    int decimatorCount;       // Number of conversions in decimatorSum
+    uint32_t sequence;        // Next sample index
+    EcgFilterChain filter;
+    QrsDetector qrs;
+    SpscRing<EcgSample, SAMPLE_RING_SIZE> samples;
+};
+AcquisitionChannel acquisitionChannels[ECG_CHANNEL_COUNT];
+bool samplingPaused = false;  // ADC stopped because every channel's leads are off
+
+// Lead-off detection
+// Every edge on a LO+/LO- pin raises a GPIO interrupt that only wakes the
+// processing task; the task debounces the pins and sends one alert per state
+// change. The pins are also read on every wake, since GPIO interrupts do not
+// fire during light sleep.
+const unsigned long LEAD_OFF_DEBOUNCE_MS = 50;
+std::atomic<bool> leadsOffState[ECG_CHANNEL_COUNT];  // Debounced, written by the processing task
+
+// Power management
+// Both cores are idle between DMA frames. With dynamic frequency scaling the
+// CPU drops to PM_MIN_FREQ_MHZ there, and the tasks hold cpuFreqLock only
+// while they work, so bursts still run at full speed and cycle counts stay
+// comparable with the deadlines. The ADC driver keeps the APB clock up while
+// it samples, so light sleep can only start once sampling is paused.
+const int PM_MIN_FREQ_MHZ = 40;  // Crystal frequency, the lowest DFS step
+esp_pm_lock_handle_t cpuFreqLock = nullptr;
+bool lightSleepEnabled = false;
+
+// Hot-path profiling
+// Each stage is timed with the CPU cycle counter into a histogram; tasks are
+// pinned, so start and end are always read on the same core. A sample is late
+// when its stage took longer than one sample period (2.78ms), and missed when
+// it never reached the processing task. Exported on /metrics in the
+// Prometheus text format.
+enum ProfileStage {
+    STAGE_SAMPLING,    // Decimating one DMA frame
+    STAGE_FILTER,      // Biquad cascade, per sample
+    STAGE_QRS,         // QRS detector, per sample
+    STAGE_PROCESS,     // processECGData, per sample
+    STAGE_ANOMALY,     // SVM decision, per batch of windows
+    STAGE_WS_SEND,     // Binary stream fan-out, per frame
+    PROFILE_STAGE_COUNT
+};
+const char* PROFILE_STAGE_NAMES[PROFILE_STAGE_COUNT] = {"sampling", "filter", "qrs", "process", "anomaly", "ws_send"};
+
+CycleHistogram stageCycles[PROFILE_STAGE_COUNT];
+uint32_t sampleDeadlineCycles = 0;                 // CPU cycles per sample period, set at boot
+std::atomic<uint32_t> samplesAcquired{0};
+std::atomic<uint32_t> lateAcquisitionSamples{0};
+std::atomic<uint32_t> lateProcessingSamples{0};
+std::atomic<uint32_t> adcPoolOverflows{0};         // DMA frames lost because acquisition fell behind
+std::atomic<uint32_t> sampleRingHighWater{0};
+std::atomic<uint32_t> recordRingHighWater{0};
+std::atomic<uint32_t> firstBlockMillis{0};         // millis() when the first sample block was processed
+
+// SVM model
+// A compile-time view over the flash tables in svm_model_params.h. Models
+// loaded at runtime share the type, so it is sized for the largest of them.
+const int MODEL_MAX_SUPPORT_VECTORS = SVM_NUM_SUPPORT_VECTORS > 224 ? SVM_NUM_SUPPORT_VECTORS : 224;
+typedef SVMModel<MODEL_MAX_SUPPORT_VECTORS, SVM_NUM_FEATURES> FloatModel;
+constexpr FloatModel svmModel = {
+    SVM_NUM_SUPPORT_VECTORS, SVM_GAMMA, SVM_BIAS, supportVectors, svmCoefficients, featureMeans, featureInverseStds,
+    supportVectorSqNorms, svmRemainingPositive, svmRemainingNegative,
+    SVM_PREFILTER ? svmPrefilterWeights : nullptr, SVM_PREFILTER_BIAS, SVM_PREFILTER_THRESHOLD
+};
+static_assert(SVM_NUM_FEATURES == ECG_BUFFER_SIZE, "Model feature count must match the ECG window size");
+
+#if SVM_ENGINE == SVM_ENGINE_QUANTIZED
+typedef QuantizedSVMModel<svm_quantized_t, SVM_NUM_SUPPORT_VECTORS, SVM_NUM_FEATURES> QuantizedModel;
+constexpr QuantizedModel quantizedSvmModel = {
+    SVM_Q_KERNEL_SCALE, SVM_Q_BIAS, SVM_Q_DECISION_UNIT, SVM_Q_MAX, SVM_Q_PRODUCT_SHIFT, SVM_EXP_LUT_SIZE, SVM_EXP_LUT_RESOLUTION,
+    quantSupportVectors, quantCoefficients, quantFeatureWeights, quantInputScales, svmExpLut,
+    featureMeans, featureInverseStds
+};
+typedef QuantizedModel AnomalyModel;
+const AnomalyModel& builtinModel = quantizedSvmModel;
+#elif SVM_ENGINE == SVM_ENGINE_RFF
+typedef RffModel<SVM_RFF_COMPONENTS, SVM_NUM_FEATURES> FourierModel;
+constexpr FourierModel rffModel = {
+    SVM_RFF_BIAS, rffProjection, rffPhases, rffWeights, featureMeans, featureInverseStds
+};
+typedef FourierModel AnomalyModel;
+const AnomalyModel& builtinModel = rffModel;
+#else
+typedef FloatModel AnomalyModel;
+const AnomalyModel& builtinModel = svmModel;
+#endif
+
+// The model inference runs with, replaced by a single pointer store when a
+// model file is activated. The processing task announces the model it holds
+// in modelInUse (a hazard pointer), so a replaced model's storage is only
+// reused once the task has moved on.
+std::atomic<const AnomalyModel*> activeModel{&builtinModel};
+std::atomic<const AnomalyModel*> modelInUse{nullptr};
+const AnomalyModel* processingModel = &builtinModel;  // Used by the processing task only
+
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+// Runtime model files
+// svm-extraction.py --binary writes a model as one aligned blob
+// (model_format.h). Two A/B slots hold such blobs: the halves of the "model"
+// data partition (partitions.csv), memory-mapped and used in place, or
+// /model/slot<N>.bin copied to RAM when the partition table has no model
+// partition. POST /model writes the inactive slot while inference carries on
+// with the active one, then switches.
+//   /model/active  slot selected at boot, "builtin" for the compiled-in model
+const char* MODEL_PARTITION_LABEL = "model";
+const esp_partition_subtype_t MODEL_PARTITION_SUBTYPE = (esp_partition_subtype_t)0x40;
+const int MODEL_SLOT_COUNT = 2;
+const size_t MODEL_MAX_FILE_SIZE = 128 * 1024;  // ~224 support vectors of 140 features
+const size_t MODEL_FLASH_SECTOR_SIZE = 4096;    // Erase unit; uploads erase one sector at a time
+const int BUILTIN_MODEL_SLOT = -1;
+
+struct ModelSlot {
+    bool valid;
+    const uint8_t* data;                  // Mapped partition or heap copy of the file
+    esp_partition_mmap_handle_t mapping;
+    bool mapped;
+    FloatModel model;                     // Points into data
+    uint32_t modelId;
+    // Cascade bounds and inverse stds, computed at load time since model files do not carry them
+    float remainingPositive[MODEL_MAX_SUPPORT_VECTORS + 1];
+    float remainingNegative[MODEL_MAX_SUPPORT_VECTORS + 1];
+    float featureInverseStds[SVM_NUM_FEATURES];
+};
+ModelSlot modelSlots[MODEL_SLOT_COUNT];
+const esp_partition_t* modelPartition = nullptr;
+size_t modelSlotSize = MODEL_MAX_FILE_SIZE;
+int activeModelSlot = BUILTIN_MODEL_SLOT;
+
+// Model upload
+// The body streams into the inactive slot through a small staging ring, so no
+// copy of the whole file is ever held. The web server task appends each chunk;
+// the recorder task, which owns flash I/O, waits for the processing task to
+// let go of the slot, then erases and writes it one sector at a time behind
+// the incoming data, yielding between sectors so the flash cache is never off
+// for long. A full ring holds the web server task for one sector's erase and
+// write at most. Once the body is complete the recorder validates the model
+// and swaps it in. An upload refused before any staging was allocated is
+// ended by the web server task; otherwise the recorder task ends it, once
+// the web server task has let go of the ring.
+const size_t MODEL_UPLOAD_STAGING_SIZE = 4 * MODEL_FLASH_SECTOR_SIZE;
+const uint32_t MODEL_UPLOAD_STALL_MS = 2000;  // Longest a chunk waits for the ring to drain
+enum ModelUploadState : uint8_t {
+    MODEL_UPLOAD_IDLE,
+    MODEL_UPLOAD_RECEIVING,          // Body arriving, the recorder task writes behind it
+    MODEL_UPLOAD_INSTALLING          // Body complete, owned by the recorder task
+};
+struct ModelUpload {
+    AsyncWebServerRequest* request;  // Request receiving the body, nullptr once answered or gone
+    int slot;
+    size_t size;
+    uint8_t* staging;                // MODEL_UPLOAD_STAGING_SIZE bytes, indexed by body offset modulo its size
+    std::atomic<size_t> received;    // Body bytes staged (web server task)
+    std::atomic<size_t> written;     // Bytes written to the slot (recorder task)
+    std::atomic<bool> released;      // The web server task no longer touches the ring
+    std::atomic<const char*> error;  // First failure, from either task
+    bool slotReleased;               // Recorder task: the slot is free to overwrite
+    File file;                       // Recorder task: SPIFFS slot file while writing
+} modelUpload;
+std::atomic<uint8_t> modelUploadState{MODEL_UPLOAD_IDLE};
+SemaphoreHandle_t modelUploadDrained = nullptr;  // Given by the recorder task after each sector
+const char* lastModelUploadError = nullptr;  // Result of the last install, nullptr when it succeeded
+#endif
+
+// What triggers an SVM evaluation
+#define ANOMALY_TRIGGER_BEAT 0     // One beat-aligned window per detected R-peak
+#define ANOMALY_TRIGGER_SLIDING 1  // Overlapping fixed windows, independent of beats
+#ifndef ANOMALY_TRIGGER
+#define ANOMALY_TRIGGER ANOMALY_TRIGGER_BEAT
+#endif
+
+// Batched inference
+// Beat windows that complete while a wake's samples are processed wait here,
+// one per channel, and are classified together at the end of the wake, so
+// the model's tables are streamed from flash once for all channels.
+// Preallocated so the hot path never touches the heap; only the processing
+// task uses these. Aligned for the esp-dsp vector routines.
+static_assert(ECG_CHANNEL_COUNT <= SVM_MAX_BATCH, "One batch must hold a window of every channel");
+alignas(16) float standardizedWindows[ECG_CHANNEL_COUNT][ECG_BUFFER_SIZE];
+bool windowPending[ECG_CHANNEL_COUNT] = {};
+
+// Patient calibration
+// The model is normalized with population statistics, which puts the normal
+// beats of some patients close to the decision boundary. Calibration takes
+// CALIBRATION_BEATS beats recorded while the patient is known to be in normal
+// rhythm, in two halves:
+//   features  streaming means of the beat windows; the input offsets move the
+//             model's training means CALIBRATION_FEATURE_WEIGHT of the way
+//             towards the patient's. The patient's means are what is kept,
+//             and the offsets are derived again whenever the model changes.
+//             The training standard deviations are kept: one patient's beats
+//             vary far less than the population's, and dividing by that
+//             spread would magnify every small deviation.
+//   decision  the full decision on windows with the new offsets goes into a
+//             ThresholdCalibrator, which moves the boundary below their mean
+//             by a bounded amount and rejects sessions in which too many
+//             beats are already anomalous (threshold_calibrator.h).
+// The result is saved to NVS by the recorder task, which owns flash writes, and
+// restored at boot; the threshold only applies to the model it was computed
+// with. Beat trigger only: the sliding detector standardizes internally.
+const int CALIBRATION_BEATS = 240;                  // ~4 minutes at 60 BPM
+const float CALIBRATION_FEATURE_WEIGHT = 0.5f;
+const uint16_t CALIBRATION_VERSION = 2;
+const char* CALIBRATION_NAMESPACE = "calibration";  // NVS keys ch0..ch3
+
+struct PatientCalibration {
+    uint16_t version;
+    uint16_t beats;                          // Beats it was computed from, 0 when uncalibrated
+    uint32_t modelId;                        // Model the threshold belongs to
+    float threshold;                         // Decision boundary, 0 is the model's own
+    float featureMeans[ECG_BUFFER_SIZE];     // Patient's mean beat window
+};
+
+struct CalibrationSession {
+    bool active;
+    int beats;
+    float featureMeans[ECG_BUFFER_SIZE];
+    ThresholdCalibrator decisions;           // In float decision units
+};
+
+enum CalibrationCommand : uint8_t {
+    CALIBRATION_NONE,
+    CALIBRATION_START,
+    CALIBRATION_CLEAR
+};
+
+// Owned by the processing task, except the commands, which the web server
+// posts, and the save buffers, handed to the recorder task by the pending flags
+PatientCalibration calibrations[ECG_CHANNEL_COUNT];
+CalibrationSession calibrationSessions[ECG_CHANNEL_COUNT];
+bool calibrationDirty[ECG_CHANNEL_COUNT] = {};
+std::atomic<uint8_t> calibrationCommands[ECG_CHANNEL_COUNT];
+PatientCalibration calibrationSaveBuffers[ECG_CHANNEL_COUNT];
+std::atomic<bool> calibrationSavePending[ECG_CHANNEL_COUNT];
+Preferences calibrationStore;
+float calibrationWindow[ECG_BUFFER_SIZE];
+// Subtracted from each feature before standardizing, for the processing model
+float calibrationOffsets[ECG_CHANNEL_COUNT][ECG_BUFFER_SIZE];
+
+// Flash recorder
+// Filtered samples are packed by the processing task into record blocks
+// (record_codec.h). Complete blocks go through a ring to a low-priority
+// recorder task that owns all flash I/O, so SPIFFS erase stalls can only
+// delay recording, never sampling.
+//   /rec/seg<N>.bin  circular log of RECORD_SEGMENT_COUNT segment files
+//   /rec/index       number of the segment currently being written
+//   /evt/<N>.bin     pre/post-trigger capture around an anomaly
+// All channels share the log; each block names its channel in the header.
+const int RECORD_SEGMENT_BLOCKS = 64;                    // 16KB per segment file
+const int RECORD_SEGMENT_COUNT = 8;                      // 128KB of history, ~4 minutes
+const int RECORD_WRITE_BATCH = 8;                        // Blocks per flash write
+const int RECORD_PRE_TRIGGER_BLOCKS = 16;                // ~7s kept in RAM before an event
+const int RECORD_POST_TRIGGER_BLOCKS = 24;               // ~10s written after an event
+const int RECORD_EVENT_FILES = 4;
+const size_t RECORD_RING_SIZE = 16;                      // Blocks between processing and recorder
+const UBaseType_t RECORDER_PRIORITY = 1;
+const uint32_t RECORDER_STACK_SIZE = 4096;
+const uint32_t RECORDER_WAKE_INTERVAL_MS = 1000;
+
+SpscRing<RecordBlock, RECORD_RING_SIZE> recordRing;
+TaskHandle_t recorderTaskHandle = nullptr;
+std::atomic<uint32_t> recordBlocksDropped{0};   // Blocks lost because the recorder fell behind
+
+// Recorder side: flash state, owned by the recorder task
+RecordBlock recordWriteBatch[RECORD_WRITE_BATCH];
+int recordBatchCount = 0;
+RecordBlock preTriggerBlocks[RECORD_PRE_TRIGGER_BLOCKS];
+int preTriggerIndex = 0;
+int preTriggerCount = 0;
+File segmentFile;
+int segmentNumber = 0;
+int segmentBlocks = 0;
+File eventFile;
+int eventNumber = 0;
+int postTriggerRemaining = 0;
+
+// Collector upload
+// Record blocks also go through a ring to an uploader task that POSTs them
+// to collectorUrl in batches over one kept-alive TLS connection, so a central
+// system does not have to hold a WebSocket open to every device. The body is
+// up to UPLOAD_BATCH_BLOCKS RecordBlocks back to back, with RECORD_FLAG_EVENT
+// marking anomalies; X-Device-Id carries the MAC address. A batch goes out
+// when it is full, UPLOAD_INTERVAL_MS after its first block or right after an
+// event. While the collector is unreachable the batch is kept and retried
+// with jittered exponential backoff; once the ring behind it fills, newer
+// blocks are dropped and counted, so processing never waits for the network.
+const size_t UPLOAD_RING_SIZE = 32;                      // Blocks between processing and uploader
+const int UPLOAD_BATCH_BLOCKS = 32;                      // 8KB per request
+const uint32_t UPLOAD_INTERVAL_MS = 15000;
+const uint32_t UPLOAD_TIMEOUT_MS = 10000;
+const uint32_t UPLOAD_BACKOFF_MIN_MS = 2000;
+const uint32_t UPLOAD_BACKOFF_MAX_MS = 300000;
+const UBaseType_t UPLOADER_PRIORITY = 1;
+const uint32_t UPLOADER_STACK_SIZE = 8192;               // Room for the TLS handshake
+const uint32_t UPLOADER_WAKE_INTERVAL_MS = 1000;
+
+SpscRing<RecordBlock, UPLOAD_RING_SIZE> uploadRing;
+TaskHandle_t uploaderTaskHandle = nullptr;               // nullptr while uploads are disabled
+std::atomic<uint32_t> uploadBlocksSent{0};
+std::atomic<uint32_t> uploadBlocksDropped{0};            // Lost because the collector fell behind
+std::atomic<uint32_t> uploadFailures{0};
+
+// Uploader side, owned by the uploader task
+RecordBlock uploadBatch[UPLOAD_BATCH_BLOCKS];
+int uploadBatchCount = 0;
+
+// Binary ECG stream
+// Samples are batched and sent as one binary WebSocket frame per channel
+// every STREAM_BATCH_INTERVAL_MS. Frame layout (little-endian):
+//   uint8  type       STREAM_FRAME_ECG
+//   uint8  decimation frame holds every Nth sample (1 = full rate)
+//   uint16 count      number of samples in the frame
+//   uint32 sequence   index of the first sample since boot, per channel
+//   uint32 timestamp  sampling time of the first sample, ms since sampling started
+//                     (sequence / SAMPLING_RATE, so processing delays do not show)
+//   uint8  channel    ECG channel the samples come from
+//   uint8  reserved
+//   uint16 span       samples covered, so the next frame starts at sequence + span
+//   int16  samples[count]  raw 12-bit ADC codes
+// STREAM_FRAME_MINMAX frames have the same header; their samples are min,
+// max pairs, each pair covering decimation consecutive samples except the
+// last one of a frame cut short, which covers what is left of span.
+const uint8_t STREAM_FRAME_ECG = 0x01;
+const uint8_t STREAM_FRAME_MINMAX = 0x02;
+const uint32_t STREAM_BATCH_INTERVAL_MS = 100;
+const int STREAM_BATCH_MAX_SAMPLES = 64;  // Flush early if a batch fills up
+
+struct __attribute__((packed)) StreamFrameHeader {
+    uint8_t type;
+    uint8_t decimation;
+    uint16_t count;
+    uint32_t sequence;
+    uint32_t timestamp;
+    uint8_t channel;
+    uint8_t reserved;
+    uint16_t span;
+};
+
+struct StreamBatch {
+    StreamFrameHeader header;
+    int16_t samples[STREAM_BATCH_MAX_SAMPLES];
+};
+StreamBatch reducedBatch;  // Decimated copy of the frame being sent, owned by the processing task
+StreamBatch minMaxBatch;   // Min/max pairs of the frame being sent, owned by the processing task
+
+// Stream subscriptions
+// A client chooses what it receives by sending {"subscribe":"<tier>"} as a
+// text message. Each tier is computed once per batch and shared by all of
+// its subscribers:
+//   raw     every sample, decimated while the client lags (the default)
+//   minmax  min and max of every WS_MINMAX_BUCKET samples, so a trend view
+//           still shows the true R-peaks at a quarter of the data rate
+//   vitals  no waveform
+// Every client gets the vitals message once per VITALS_INTERVAL_MS.
+// Requests arrive on the async_tcp task and are handed to the processing
+// task, which owns the client states, through a ring.
+enum StreamTier : uint8_t {
+    STREAM_TIER_RAW,
+    STREAM_TIER_MINMAX,
+    STREAM_TIER_VITALS,
+    STREAM_TIER_COUNT
+};
+const char* const STREAM_TIER_NAMES[STREAM_TIER_COUNT] = {"raw", "minmax", "vitals"};
+const uint8_t WS_MINMAX_BUCKET = 8;
+const unsigned long VITALS_INTERVAL_MS = 1000;
+const size_t WS_SUBSCRIPTION_QUEUE_SIZE = 8;
+const size_t WS_SUBSCRIPTION_MAX_LENGTH = 64;  // Longer text messages are ignored
+const char* VITALS_MESSAGE_FORMAT = "{\"type\":\"vitals\",\"channel\":%d,\"heartRate\":%.1f,\"rrInterval\":%u,"
+                                    "\"sdnn\":%.1f,\"rmssd\":%.1f,\"pnn50\":%.3f,\"irregularity\":%.3f,"
+                                    "\"anomalies\":%u,\"leadsOff\":%s}";
+static_assert(STREAM_BATCH_MAX_SAMPLES % WS_MINMAX_BUCKET == 0, "Full batches must split into whole buckets");
+
+struct WsSubscription {
+    uint32_t clientId;
+    StreamTier tier;
+};
+SpscRing<WsSubscription, WS_SUBSCRIPTION_QUEUE_SIZE> wsSubscriptions;
+unsigned long lastVitalsUpdate = 0;
+
+// WebSocket fan-out policy
+// Each client's send queue is checked before every frame instead of pushing
+// into it unconditionally. A client that falls behind gets a decimated frame,
+// one whose queue stays saturated gets nothing, and one that is stuck for
+// WS_STALL_TIMEOUT_MS is disconnected, so a single slow phone cannot grow the
+// AsyncWebSocket queues until the heap runs out.
+const size_t WS_QUEUE_THROTTLE_DEPTH = 4;       // Queued messages before decimating
+const size_t WS_QUEUE_SKIP_DEPTH = 8;           // Queued messages before skipping frames
+const uint8_t WS_SLOW_CLIENT_DECIMATION = 4;    // Keep every 4th sample for slow clients
+const unsigned long WS_STALL_TIMEOUT_MS = 5000;
+const int MAX_WS_CLIENTS = 4;                   // Oldest clients beyond this are closed
+static_assert(WS_MINMAX_BUCKET % WS_SLOW_CLIENT_DECIMATION == 0, "Batches cut at whole buckets must decimate evenly");
+
+struct WsClientState {
+    bool inUse;
+    bool seen;                  // Still connected during the current fan-out pass
+    uint32_t id;
+    StreamTier tier;
+    unsigned long stalledSince; // millis() when frames started being skipped, 0 if flowing
+};
+WsClientState wsClientStates[MAX_WS_CLIENTS + 1];  // Owned by the processing task
+
+// Connected clients
+// AsyncWebSocket's own client list is changed by the async_tcp task on
+// connect and disconnect, so the processing task never walks it. The event
+// handler keeps this registry instead, under wsClientsLock: a client is added
+// on WS_EVT_CONNECT and removed on WS_EVT_DISCONNECT, before the library frees
+// it, so every pointer found here while holding the lock is still valid.
+// One spare slot holds a client while the oldest one is being closed.
+AsyncWebSocketClient* wsClients[MAX_WS_CLIENTS + 1];  // Oldest first
+std::atomic<int> wsClientCount{0};
+SemaphoreHandle_t wsClientsLock = nullptr;          // Created before the server can accept clients
+uint32_t wsFramesDecimated = 0;
+uint32_t wsFramesSkipped = 0;
+uint32_t wsSlowClientsDropped = 0;
+
+// WebSocket status messages
+// JSON messages are formatted into a fixed-size buffer on the sender's stack
+// instead of being concatenated from String objects, so sustained traffic
+// does not fragment the heap. Broadcasts go to each client in the registry,
+// so they are safe from any task.
+const size_t WS_MESSAGE_SIZE = 192;
+const char* CALORIES_MESSAGE_FORMAT = "{\"type\":\"calories\",\"channel\":%d,\"value\":%.1f,\"heartRate\":%.1f}";
+
+struct WsMessage {
+    char text[WS_MESSAGE_SIZE];
+    size_t length;
+};
+std::atomic<uint32_t> wsMessagesTooLong{0};  // Sent from the processing and async_tcp tasks
+std::atomic<uint32_t> beatsDropped{0};       // Beats never classified because too many segments were pending
+
+// Processing side of a channel, owned by the processing task
+struct ChannelState {
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_BEAT
+    BeatSegmenter beatSegmenter;
+#else
+    SlidingAnomalyDetector<AnomalyModel> slidingDetector{builtinModel};
+#endif
+    StreamBatch streamBatch;
+    unsigned long streamBatchStart;  // millis() when the batch got its first sample, for the flush interval
+    RecordBlockEncoder recordEncoder;
+    bool recordEventPending;
+    float heartRate;
+    uint16_t rrInterval;             // Samples between the last two beats, 0 before the second beat
+    HrvStats hrv;
+    uint32_t anomalyCount;           // Anomalies reported since boot
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_BEAT
+    uint32_t beatsDroppedSeen;       // beatSegmenter.droppedBeats() already added to beatsDropped
+#endif
+    float dailyCalories;
+    unsigned long lastAnomalyTime;
+    unsigned long leadChangeSince;   // millis() when the pins started to disagree with leadsOffState, 0 if they agree
+};
+ChannelState channels[ECG_CHANNEL_COUNT];
 
 // Web server
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
 
+// Dashboard assets, gzipped at build time by gzip-web-files.py
+// Serves every <path>.gz under WEB_ROOT with Content-Encoding: gzip, an ETag
+// taken from the gzip trailer (CRC32 + length) and answers 304 when the
+// browser already holds that version
+const char* WEB_ROOT = "/www";
+const char* WEB_CACHE_CONTROL = "public, max-age=600";  // Revalidated with If-None-Match afterwards
+
+class GzipAssetHandler : public AsyncWebHandler {
+public:
+    GzipAssetHandler(const char* root, const char* defaultFile) : root(root), defaultFile(defaultFile) {}
+    bool canHandle(AsyncWebServerRequest *request) override;
+    void handleRequest(AsyncWebServerRequest *request) override;
+
+private:
+    String assetPath(AsyncWebServerRequest *request) const;
+    static const char* contentType(const String& path);
+    
+    String root;
+    String defaultFile;
+};
+
 // Function prototypes
+void setupSVMModel();
+void setupSampler();
+bool readSampleBlock(uint16_t (*samples)[SAMPLE_BLOCK_SIZE], size_t* sampleCounts, uint32_t timeoutMs);
+bool leadsOff(int channel);
+bool readLeadPins(int channel);
+void updateLeadState();
+void IRAM_ATTR onLeadChange();
+void pauseSampling();
+void resumeSampling();
+TickType_t processingWakeTimeout();
+void setupPowerManagement();
+void holdCpuFrequency();
+void releaseCpuFrequency();
+void startTasks();
+void acquisitionTask(void* parameter);
+void processingTask(void* parameter);
 void setupWiFi();
+void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+void reconnectWiFi();
 void setupSPIFFS();
 void setupWebServer();
 void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, 
                      AwsEventType type, void *arg, uint8_t *data, size_t len);
-void processECGData();
-float calculateHeartRate(const std::vector<float>& ecgData);
+bool addWsClient(AsyncWebSocketClient* client);
+void removeWsClient(AsyncWebSocketClient* client);
+void queueStreamSample(int channel, const EcgSample& sample);
+void flushStreamBatch(int channel);
+void broadcastStreamFrame(const StreamBatch& full, const StreamBatch& reduced, const StreamBatch& minMax);
+size_t streamFrameLength(const StreamBatch& batch);
+bool parseSubscription(const char* text, size_t length, StreamTier& tier);
+void applyWsSubscriptions();
+void broadcastVitals();
+bool formatWsMessage(WsMessage& message, const char* format, ...) __attribute__((format(printf, 2, 3)));
+void broadcastWsMessage(const char* format, ...) __attribute__((format(printf, 1, 2)));
+bool formatWsMessageV(WsMessage& message, const char* format, va_list args);
+WsClientState* wsClientState(uint32_t clientId);
+void processECGData(int channel, const EcgSample& sample);
+void classifyPendingWindows();
+void reportAnomaly(int channel);
+void recordSample(int channel, const EcgSample& sample);
+void submitRecordBlock(int channel);
+void recorderTask(void* parameter);
+void setupRecorder();
+void uploaderTask(void* parameter);
+bool postUploadBatch(HTTPClient& http, WiFiClientSecure& client, const String& deviceId);
+void handleRecordBlock(const RecordBlock& block);
+void writeSegmentBatch();
+void openSegment(int number);
+void startEventCapture(const RecordBlock& trigger);
+void handleRecordingList(AsyncWebServerRequest *request);
+void handleRecordingDownload(AsyncWebServerRequest *request);
+String recordingPath(const String& name);
+bool parseDecimal(const String& text, size_t& value);
+bool parseByteRange(const String& range, size_t size, size_t& start, size_t& end);
+void handleMetrics(AsyncWebServerRequest *request);
+void refreshProcessingModel();
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+bool loadModelSlot(int slot, const char*& error);
+void releaseModelSlot(int slot);
+void activateModel(int slot);
+void handleModelInfo(AsyncWebServerRequest *request);
+void handleModelActivate(AsyncWebServerRequest *request);
+void handleModelUpload(AsyncWebServerRequest *request);
+void handleModelUploadBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
+void beginModelUpload(AsyncWebServerRequest *request, size_t total);
+void serviceModelUpload();
+void failModelUpload(const char* error);
+void abortModelUpload(AsyncWebServerRequest *request);
+void endModelUpload();
+#endif
+void printHistogram(Print& out, const char* name, const char* label, const CycleHistogram& histogram);
+bool IRAM_ATTR onAdcPoolOverflow(adc_continuous_handle_t handle, const adc_continuous_evt_data_t* data, void* context);
 float calculateCalories(float heartRate, unsigned long elapsedMinutes);
-bool detectAnomaly(const std::vector<float>& ecgData);
-float rbfKernel(const std::vector<float>& x1, const std::vector<float>& x2, float gamma);
-void standardizeFeatures(std::vector<float>& features);
+void detectAnomalies(const float* const* windows, int count, bool* anomalous, const float* thresholds);
+uint32_t modelIdOf(const AnomalyModel* model);
+void loadCalibrations();
+void serviceCalibrations();
+void calibrateBeat(int channel, const float* segment);
+void finishCalibration(int channel);
+void updateCalibrationOffsets(int channel, const AnomalyModel* model);
+void saveCalibrations();
+void handleCalibrationInfo(AsyncWebServerRequest *request);
+void handleCalibrationCommand(AsyncWebServerRequest *request);
 
 void setup() {
     // Initialize serial communication
     Serial.begin(115200);
     
     // Initialize pins
-    pinMode(ECG_PIN, INPUT);
-    pinMode(LO_PLUS_PIN, INPUT);
-    pinMode(LO_MINUS_PIN, INPUT);
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        pinMode(ECG_CHANNEL_PINS[c].ecg, INPUT);
+        pinMode(ECG_CHANNEL_PINS[c].loPlus, INPUT);
+        pinMode(ECG_CHANNEL_PINS[c].loMinus, INPUT);
+        leadsOffState[c].store(readLeadPins(c));
+    }
     pinMode(BUZZER_PIN, OUTPUT);
     digitalWrite(BUZZER_PIN, LOW);
     
     // Initialize system components
-    setupSVMModel();
+    setupPowerManagement();
     setupSPIFFS();
-    setupWiFi();
-    setupWebServer();
+    setupSVMModel();
+    loadCalibrations();
     
     // Record start time
     startTime = millis();
     lastCalorieUpdate = startTime;
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        channels[c].streamBatch.header.channel = c;
+    }
+    
+    // Monitoring starts before any networking, which can take seconds or never succeed
+    setupSampler();
+    startTasks();
     
-    Serial.println("ECG Monitoring System Initialized");
+    setupWebServer();
+    setupWiFi();
+    
+    Serial.printf("ECG Monitoring System Initialized after %lu ms\n", millis());
 }
 
 void loop() {
-    // Check if leads are properly attached
-    if (digitalRead(LO_PLUS_PIN) == HIGH || digitalRead(LO_MINUS_PIN) == HIGH) {
-        // Leads are off, send alert
-        String message = "{\"type\":\"alert\",\"message\":\"Leads are not properly attached\"}";
-        ws.textAll(message);
-        delay(1000);
-        return;
+    // All work happens in the pinned acquisition and processing tasks
+    vTaskDelete(NULL);
+}
+
+void startTasks() {
+    // Cycle counts per sample period for the late-sample checks
+    sampleDeadlineCycles = getCpuFrequencyMhz() * 1000000 / SAMPLING_RATE;
+    
+    xTaskCreatePinnedToCore(recorderTask, "recorder", RECORDER_STACK_SIZE, nullptr,
+                            RECORDER_PRIORITY, &recorderTaskHandle, PROCESSING_CORE);
+    if (collectorUrl[0] != '\0' && collectorCaCert == nullptr) {
+        Serial.println("collectorCaCert is not set, uploads disabled");
+    } else if (collectorUrl[0] != '\0') {
+        xTaskCreatePinnedToCore(uploaderTask, "uploader", UPLOADER_STACK_SIZE, nullptr,
+                                UPLOADER_PRIORITY, &uploaderTaskHandle, PROCESSING_CORE);
+    }
+    xTaskCreatePinnedToCore(processingTask, "processing", PROCESSING_STACK_SIZE, nullptr,
+                            PROCESSING_PRIORITY, &processingTaskHandle, PROCESSING_CORE);
+    xTaskCreatePinnedToCore(acquisitionTask, "acquisition", ACQUISITION_STACK_SIZE, nullptr,
+                            ACQUISITION_PRIORITY, &acquisitionTaskHandle, ACQUISITION_CORE);
+    
+    // Lead changes wake the processing task, which is the one to act on them
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        attachInterrupt(digitalPinToInterrupt(ECG_CHANNEL_PINS[c].loPlus), onLeadChange, CHANGE);
+        attachInterrupt(digitalPinToInterrupt(ECG_CHANNEL_PINS[c].loMinus), onLeadChange, CHANGE);
     }
+}
+
+void acquisitionTask(void* parameter) {
+    uint16_t samples[ECG_CHANNEL_COUNT][SAMPLE_BLOCK_SIZE];
+    size_t sampleCounts[ECG_CHANNEL_COUNT];
     
-    // Read ECG data
-    unsigned long currentTime = micros();
-    if (currentTime - lastSampleTime >= SAMPLE_INTERVAL) {
-        lastSampleTime = currentTime;
+    for (;;) {
+        // Nothing to measure with every lead off: stop the converter until the
+        // processing task reports one reattached, so the CPU can sleep
+        bool allLeadsOff = true;
+        for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+            allLeadsOff = allLeadsOff && leadsOff(c);
+        }
+        if (allLeadsOff) {
+            pauseSampling();
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        resumeSampling();
+        
+        // Blocks until the DMA engine has completed conversions; returns with
+        // the CPU frequency held
+        if (!readSampleBlock(samples, sampleCounts, ADC_READ_TIMEOUT_MS)) {
+            continue;
+        }
+        
+        uint32_t blockStart = esp_cpu_get_cycle_count();
+        size_t blockSamples = 0;
+        size_t periods = 0;
+        for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+            AcquisitionChannel& channel = acquisitionChannels[c];
+            
+            // With the leads off the input is meaningless, restart beat detection
+            if (leadsOff(c)) {
+                channel.filter.reset();
+                channel.qrs.reset();
+            }
+            
+            for (size_t i = 0; i < sampleCounts[c]; i++) {
+                EcgSample sample = {};
+                sample.sequence = channel.sequence++;
+                sample.raw = samples[c][i];
+                
+                uint32_t start = esp_cpu_get_cycle_count();
+                sample.filtered = channel.filter.process(samples[c][i]);
+                uint32_t filtered = esp_cpu_get_cycle_count();
+                if (channel.qrs.update(sample.filtered * FILTERED_TO_VOLTS)) {
+                    sample.rrInterval = channel.qrs.rrInterval();
+                    sample.beatLag = channel.qrs.beatLag();
+                }
+                uint32_t end = esp_cpu_get_cycle_count();
+                stageCycles[STAGE_FILTER].record(filtered - start);
+                stageCycles[STAGE_QRS].record(end - filtered);
+                
+                if (!channel.samples.push(sample)) {
+                    droppedSamples.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            
+            blockSamples += sampleCounts[c];
+            if (sampleCounts[c] > periods) {
+                periods = sampleCounts[c];
+            }
+            uint32_t depth = channel.samples.size();
+            if (depth > sampleRingHighWater.load(std::memory_order_relaxed)) {
+                sampleRingHighWater.store(depth, std::memory_order_relaxed);
+            }
+        }
+        if (blockSamples > 0) {
+            if (firstBlockMillis.load(std::memory_order_relaxed) == 0) {
+                firstBlockMillis.store(millis(), std::memory_order_relaxed);
+            }
+            samplesAcquired.fetch_add(blockSamples, std::memory_order_relaxed);
+            
+            // The whole frame arrives at once, so it has one sample period per sample of a channel
+            if (esp_cpu_get_cycle_count() - blockStart > periods * sampleDeadlineCycles) {
+                lateAcquisitionSamples.fetch_add(blockSamples, std::memory_order_relaxed);
+            }
+            xTaskNotifyGive(processingTaskHandle);
+        }
+        releaseCpuFrequency();
+    }
+}
+
+void pauseSampling() {
+    if (samplingPaused || adcHandle == nullptr) {
+        return;
+    }
+    adc_continuous_stop(adcHandle);
+    samplingPaused = true;
+    Serial.println("All leads off, sampling paused");
+}
+
+void resumeSampling() {
+    if (!samplingPaused) {
+        return;
+    }
+    // Conversions from before the pause must not mix into new samples
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        acquisitionChannels[c].decimatorSum = 0;
+        acquisitionChannels[c].decimatorCount = 0;
+    }
+    if (adc_continuous_start(adcHandle) != ESP_OK) {
+        Serial.println("Failed to restart ADC continuous mode");
+        return;
+    }
+    samplingPaused = false;
+    Serial.println("Sampling resumed");
+}
+
+bool leadsOff(int channel) {
+    return leadsOffState[channel].load(std::memory_order_relaxed);
+}
+
+bool readLeadPins(int channel) {
+    return digitalRead(ECG_CHANNEL_PINS[channel].loPlus) == HIGH ||
+           digitalRead(ECG_CHANNEL_PINS[channel].loMinus) == HIGH;
+}
+
+void IRAM_ATTR onLeadChange() {
+    // Shared by every lead-off pin; the processing task reads them all
+    BaseType_t woken = pdFALSE;
+    if (processingTaskHandle != nullptr) {
+        vTaskNotifyGiveFromISR(processingTaskHandle, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+void updateLeadState() {
+    // A change counts once the pins have held it for LEAD_OFF_DEBOUNCE_MS
+    unsigned long now = millis();
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        ChannelState& channel = channels[c];
+        bool off = readLeadPins(c);
+        if (off == leadsOff(c)) {
+            channel.leadChangeSince = 0;
+            continue;
+        }
+        if (channel.leadChangeSince == 0) {
+            channel.leadChangeSince = now | 1;  // 0 means no change pending
+            continue;
+        }
+        if (now - channel.leadChangeSince < LEAD_OFF_DEBOUNCE_MS) {
+            continue;
+        }
         
-        // Read ECG value and add to buffer
-        int ecgValue = analogRead(ECG_PIN);
+        leadsOffState[c].store(off, std::memory_order_relaxed);
+        channel.leadChangeSince = 0;
+        xTaskNotifyGive(acquisitionTaskHandle);  // May have to pause or resume sampling
+        broadcastWsMessage("{\"type\":\"alert\",\"channel\":%d,\"leadsOff\":%s,\"message\":\"%s\"}",
+                           c, off ? "true" : "false", off ? "Leads are not properly attached" : "Leads reattached");
+    }
+}
+
+TickType_t processingWakeTimeout() {
+    // Samples and lead changes notify the task; otherwise it only wakes for
+    // the nearest timer, so an idle system sleeps as long as possible
+    unsigned long timeout = PROCESSING_IDLE_WAKE_MS;
+    if (anomalyDetected) {
+        unsigned long elapsed = millis() - lastBuzzerTime;
+        unsigned long remaining = elapsed > BUZZER_DURATION ? 0 : BUZZER_DURATION - elapsed + 1;
+        if (remaining < timeout) {
+            timeout = remaining;
+        }
+    }
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        if (channels[c].leadChangeSince != 0 && LEAD_OFF_DEBOUNCE_MS < timeout) {
+            timeout = LEAD_OFF_DEBOUNCE_MS;
+        }
+    }
+    return pdMS_TO_TICKS(timeout);
+}
+
+void processingTask(void* parameter) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, processingWakeTimeout());
+        holdCpuFrequency();
+        refreshProcessingModel();
+        updateLeadState();
+        applyWsSubscriptions();
+        serviceCalibrations();
         
-        // Convert to voltage (0-3.3V for ESP32 ADC)
-        float voltage = ecgValue * (3.3 / 4095.0);
+        for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+            ChannelState& channel = channels[c];
+            SpscRing<EcgSample, SAMPLE_RING_SIZE>& samples = acquisitionChannels[c].samples;
+            
+            // Check if leads are properly attached
+            if (leadsOff(c)) {
+                // updateLeadState() has sent the alert; discard the meaningless
+                // samples, which leaves a sequence gap that clients can see
+                if (channel.streamBatch.header.count > 0) {
+                    flushStreamBatch(c);
+                }
+                EcgSample discarded;
+                while (samples.pop(discarded)) {
+                }
+                channel.hrv.reset();
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_BEAT
+                channel.beatSegmenter.reset();
+                windowPending[c] = false;
+#else
+                channel.slidingDetector.reset();
+#endif
+                continue;
+            }
+            
+            EcgSample sample;
+            while (samples.pop(sample)) {
+                uint32_t start = esp_cpu_get_cycle_count();
+                processECGData(c, sample);
+                uint32_t cycles = esp_cpu_get_cycle_count() - start;
+                stageCycles[STAGE_PROCESS].record(cycles);
+                if (cycles > sampleDeadlineCycles) {
+                    lateProcessingSamples.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            
+            // Batches are cut at whole min/max buckets, which are a multiple
+            // of the slow-client decimation, so every tier's frames cover
+            // exactly the same samples
+            const StreamFrameHeader& header = channel.streamBatch.header;
+            if (header.count > 0 && header.count % WS_MINMAX_BUCKET == 0 &&
+                millis() - channel.streamBatchStart >= STREAM_BATCH_INTERVAL_MS) {
+                flushStreamBatch(c);
+            }
+        }
+        classifyPendingWindows();
         
-        // Add to buffer (circular buffer implementation)
-        ecgBuffer[bufferIndex] = voltage;
-        bufferIndex = (bufferIndex + 1) % ECG_BUFFER_SIZE;
+        // Handle buzzer timeout
+        if (anomalyDetected && (millis() - lastBuzzerTime > BUZZER_DURATION)) {
+            digitalWrite(BUZZER_PIN, LOW);
+            anomalyDetected = false;
+        }
         
-        // Stream real-time ECG data to WebSocket clients
-        if (bufferIndex % 5 == 0) { // Send every 5 samples to reduce traffic
-            String ecgData = "{\"type\":\"ecg\",\"value\":" + String(voltage, 3) + "}";
-            ws.textAll(ecgData);
+        // Update calories every minute
+        if (millis() - lastCalorieUpdate >= CALORIE_UPDATE_INTERVAL) {
+            unsigned long elapsedMinutes = (millis() - startTime) / 60000;
+            for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+                ChannelState& channel = channels[c];
+                // The mean over the HRV window is steadier than the smoothed beat-to-beat rate
+                float averageRate = channel.hrv.intervalCount() > 0 ? channel.hrv.meanHeartRate() : channel.heartRate;
+                channel.dailyCalories = calculateCalories(averageRate, elapsedMinutes);
+                
+                // Send calorie update to WebSocket clients
+                broadcastWsMessage(CALORIES_MESSAGE_FORMAT, c, channel.dailyCalories, channel.heartRate);
+            }
+            
+            lastCalorieUpdate = millis();
         }
         
-        // Process complete buffer every 30ms for anomaly detection
-        // 30ms at 360Hz is about 11 samples, but we'll use the full buffer once filled
-        if (bufferIndex == 0) { // Buffer is full and wrapped around
-            processECGData();
+        if (millis() - lastVitalsUpdate >= VITALS_INTERVAL_MS) {
+            broadcastVitals();
+            lastVitalsUpdate = millis();
         }
+        releaseCpuFrequency();
     }
+}
+
+void setupPowerManagement() {
+    esp_pm_config_t config = {};
+    config.max_freq_mhz = getCpuFrequencyMhz();
+    config.min_freq_mhz = PM_MIN_FREQ_MHZ;
+    config.light_sleep_enable = true;
     
-    // Handle buzzer timeout
-    if (anomalyDetected && (millis() - lastAnomalyTime > BUZZER_DURATION)) {
-        digitalWrite(BUZZER_PIN, LOW);
-        anomalyDetected = false;
+    // Light sleep needs an SDK built with tickless idle; frequency scaling alone still helps
+    if (esp_pm_configure(&config) != ESP_OK) {
+        config.light_sleep_enable = false;
+        if (esp_pm_configure(&config) != ESP_OK) {
+            Serial.println("Power management not available, running at a fixed CPU frequency");
+            return;
+        }
+    }
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "ecg", &cpuFreqLock) != ESP_OK) {
+        cpuFreqLock = nullptr;
+    }
+    lightSleepEnabled = config.light_sleep_enable;
+    Serial.printf("Power management: %d-%d MHz, light sleep %s\n", config.min_freq_mhz, config.max_freq_mhz,
+                  lightSleepEnabled ? "enabled" : "not available");
+}
+
+void holdCpuFrequency() {
+    // Counted lock, shared by the acquisition and processing tasks
+    if (cpuFreqLock != nullptr) {
+        esp_pm_lock_acquire(cpuFreqLock);
+    }
+}
+
+void releaseCpuFrequency() {
+    if (cpuFreqLock != nullptr) {
+        esp_pm_lock_release(cpuFreqLock);
+    }
+}
+
+void setupSVMModel() {
+#if SVM_ENGINE == SVM_ENGINE_QUANTIZED
+    // The quantized tables live in flash (svm_model_quantized.h); runtime model
+    // files hold float models only
+    Serial.printf("SVM model initialized: %d support vectors, %d features, %d-bit quantized\n",
+                  quantizedSvmModel.numSupportVectors, quantizedSvmModel.numFeatures,
+                  (int)sizeof(svm_quantized_t) * 8);
+#elif SVM_ENGINE == SVM_ENGINE_RFF
+    // Linear model over random Fourier features (svm_model_rff.h), also compiled in
+    Serial.printf("SVM model initialized: %d random Fourier features, %d inputs\n",
+                  rffModel.numComponents, rffModel.numFeatures);
+#else
+    // Model files in the A/B slots, falling back to the compiled-in model
+    modelPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, MODEL_PARTITION_SUBTYPE,
+                                              MODEL_PARTITION_LABEL);
+    if (modelPartition != nullptr) {
+        modelSlotSize = modelPartition->size / MODEL_SLOT_COUNT / MODEL_FLASH_SECTOR_SIZE * MODEL_FLASH_SECTOR_SIZE;
+        if (modelSlotSize > MODEL_MAX_FILE_SIZE) {
+            modelSlotSize = MODEL_MAX_FILE_SIZE;
+        }
+    }
+    for (int slot = 0; slot < MODEL_SLOT_COUNT; slot++) {
+        const char* error = nullptr;
+        if (loadModelSlot(slot, error)) {
+            Serial.printf("Model slot %d: model %u, %d support vectors\n", slot,
+                          (unsigned)modelSlots[slot].modelId, modelSlots[slot].model.numSupportVectors);
+        }
     }
     
-    // Update calories every minute
-    if (millis() - lastCalorieUpdate >= CALORIE_UPDATE_INTERVAL) {
-        unsigned long elapsedMinutes = (millis() - startTime) / 60000;
-        dailyCalories = calculateCalories(heartRate, elapsedMinutes);
-        
-        // Send calorie update to WebSocket clients
-        String calorieData = "{\"type\":\"calories\",\"value\":" + String(dailyCalories, 1) + 
-                            ",\"heartRate\":" + String(heartRate, 1) + "}";
-        ws.textAll(calorieData);
+    int slot = BUILTIN_MODEL_SLOT;
+    File activeFile = SPIFFS.open("/model/active", "r");
+    if (activeFile) {
+        String selected = activeFile.readString();
+        activeFile.close();
+        if (selected != "builtin") {
+            slot = selected.toInt();
+        }
+    }
+    if (slot < 0 || slot >= MODEL_SLOT_COUNT || !modelSlots[slot].valid) {
+        slot = BUILTIN_MODEL_SLOT;
+    }
+    activeModel.store(slot == BUILTIN_MODEL_SLOT ? &svmModel : &modelSlots[slot].model);
+    activeModelSlot = slot;
+    
+    const FloatModel& model = *activeModel.load();
+    Serial.printf("SVM model initialized: %d support vectors, %d features (%s)\n",
+                  model.numSupportVectors, model.numFeatures,
+                  slot == BUILTIN_MODEL_SLOT ? "built in" : (modelPartition ? "model partition" : "SPIFFS"));
+#endif
+}
+
+void refreshProcessingModel() {
+    // Hazard pointer: announce the model before using it, and retry if it was
+    // replaced in between, so activateModel() callers never reclaim it early
+    const AnomalyModel* model;
+    do {
+        model = activeModel.load();
+        modelInUse.store(model);
+    } while (model != activeModel.load());
+    
+    if (model != processingModel) {
+        processingModel = model;
         
-        lastCalorieUpdate = millis();
+        // Thresholds are in the old model's decision units, offsets relative to its means
+        uint32_t modelId = modelIdOf(model);
+        for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+            updateCalibrationOffsets(c, model);
+            if (calibrations[c].threshold != 0.0f && calibrations[c].modelId != modelId) {
+                calibrations[c].threshold = 0.0f;
+                calibrationDirty[c] = true;
+                Serial.printf("Model changed, calibration threshold of channel %d reset\n", c);
+            }
+            calibrations[c].modelId = modelId;
+            if (calibrationSessions[c].active) {
+                // Restart, the collected decisions came from the old model
+                calibrationSessions[c] = {};
+                calibrationSessions[c].active = true;
+            }
+        }
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_SLIDING
+        for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+            channels[c].slidingDetector.setModel(*model);  // Partial windows were built against the old model
+        }
+#endif
     }
 }
 
-void setupSVMModel() {
-    // In a real implementation, you would load these values from SPIFFS or hardcode from the trained model
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+bool loadModelSlot(int slot, const char*& error) {
+    releaseModelSlot(slot);
+    ModelSlot& modelSlot = modelSlots[slot];
+    size_t size = modelSlotSize;
+    
+    if (modelPartition != nullptr) {
+        // Mapped read-only into the data cache, used in place
+        const void* mapped = nullptr;
+        if (esp_partition_mmap(modelPartition, slot * modelSlotSize, modelSlotSize, ESP_PARTITION_MMAP_DATA,
+                               &mapped, &modelSlot.mapping) != ESP_OK) {
+            error = "cannot map model partition";
+            return false;
+        }
+        modelSlot.data = (const uint8_t*)mapped;
+        modelSlot.mapped = true;
+    } else {
+        // SPIFFS cannot be mapped, keep one aligned copy in RAM
+        File file = SPIFFS.open("/model/slot" + String(slot) + ".bin", "r");
+        if (!file) {
+            error = "no model file";
+            return false;
+        }
+        size = file.size();
+        if (size > MODEL_MAX_FILE_SIZE) {
+            file.close();
+            error = "model file too large";
+            return false;
+        }
+        uint8_t* copy = (uint8_t*)heap_caps_aligned_alloc(MODEL_FILE_ALIGNMENT, size, MALLOC_CAP_8BIT);
+        if (copy == nullptr) {
+            file.close();
+            error = "not enough memory for the model";
+            return false;
+        }
+        size_t read = file.read(copy, size);
+        file.close();
+        modelSlot.data = copy;
+        if (read != size) {
+            releaseModelSlot(slot);
+            error = "cannot read model file";
+            return false;
+        }
+    }
     
-    // Example values - THESE NEED TO BE REPLACED with actual values from your trained model
-    svmModel.numSupportVectors = 50;  // Example number of support vectors
-    svmModel.gamma = 0.01;            // RBF kernel parameter
-    svmModel.bias = -0.5;             // Model bias term
+    ModelFileView view;
+    if (!parseModelFile(modelSlot.data, size, SVM_NUM_FEATURES, MODEL_MAX_SUPPORT_VECTORS, view, error)) {
+        releaseModelSlot(slot);
+        return false;
+    }
+    int numSupportVectors = (int)view.header->numSupportVectors;
+    computeCascadeBounds(view.dualCoefficients, numSupportVectors, modelSlot.remainingPositive,
+                         modelSlot.remainingNegative);
+    computeInverseStds(view.featureStds, SVM_NUM_FEATURES, modelSlot.featureInverseStds);
+    // prefilter: bias, threshold, two pad words, then the weights
+    modelSlot.model = {numSupportVectors, view.header->gamma, view.header->bias,
+                       view.supportVectors, view.dualCoefficients, view.featureMeans, modelSlot.featureInverseStds,
+                       view.supportVectorSqNorms, modelSlot.remainingPositive, modelSlot.remainingNegative,
+                       view.prefilter != nullptr ? view.prefilter + 4 : nullptr,
+                       view.prefilter != nullptr ? view.prefilter[0] : 0.0f,
+                       view.prefilter != nullptr ? view.prefilter[1] : 0.0f};
+    modelSlot.modelId = view.header->modelId;
+    modelSlot.valid = true;
+    return true;
+}
+
+void releaseModelSlot(int slot) {
+    // Callers make sure the processing task is not using this slot
+    ModelSlot& modelSlot = modelSlots[slot];
+    if (modelSlot.mapped) {
+        esp_partition_munmap(modelSlot.mapping);
+    } else if (modelSlot.data != nullptr) {
+        heap_caps_free((void*)modelSlot.data);
+    }
+    modelSlot.data = nullptr;
+    modelSlot.mapped = false;
+    modelSlot.valid = false;
+}
+
+void activateModel(int slot) {
+    activeModel.store(slot == BUILTIN_MODEL_SLOT ? &svmModel : &modelSlots[slot].model);
+    activeModelSlot = slot;
     
-    // Reserve space for support vectors (flattened)
-    svmModel.supportVectors.resize(svmModel.numSupportVectors * ECG_BUFFER_SIZE);
-    svmModel.dualCoefficients.resize(svmModel.numSupportVectors);
-    svmModel.featureMeans.resize(ECG_BUFFER_SIZE);
-    svmModel.featureStds.resize(ECG_BUFFER_SIZE);
+    File activeFile = SPIFFS.open("/model/active", "w");
+    if (activeFile) {
+        activeFile.print(slot == BUILTIN_MODEL_SLOT ? String("builtin") : String(slot));
+        activeFile.close();
+    }
+    Serial.printf("Activated model %s\n", slot == BUILTIN_MODEL_SLOT ? "builtin" : String(slot).c_str());
+}
+
+void handleModelInfo(AsyncWebServerRequest *request) {
+    if (modelUploadState.load(std::memory_order_acquire) == MODEL_UPLOAD_INSTALLING) {
+        // The recorder task is rewriting the slots
+        request->send(200, "application/json", "{\"upload\":\"installing\"}");
+        return;
+    }
+    const FloatModel& model = *activeModel.load();
+    AsyncResponseStream* response = request->beginResponseStream("application/json");
+    response->printf("{\"active\":\"%s\",\"storage\":\"%s\",\"supportVectors\":%d,\"features\":%d,\"slots\":[",
+                     activeModelSlot == BUILTIN_MODEL_SLOT ? "builtin" : String(activeModelSlot).c_str(),
+                     modelPartition ? "partition" : "spiffs", model.numSupportVectors, model.numFeatures);
+    for (int slot = 0; slot < MODEL_SLOT_COUNT; slot++) {
+        const ModelSlot& modelSlot = modelSlots[slot];
+        if (modelSlot.valid) {
+            response->printf("%s{\"slot\":%d,\"modelId\":%u,\"supportVectors\":%d}", slot ? "," : "", slot,
+                             (unsigned)modelSlot.modelId, modelSlot.model.numSupportVectors);
+        } else {
+            response->printf("%s{\"slot\":%d,\"empty\":true}", slot ? "," : "", slot);
+        }
+    }
+    if (lastModelUploadError != nullptr) {
+        response->printf("],\"uploadError\":\"%s\"}", lastModelUploadError);
+    } else {
+        response->print("]}");
+    }
+    request->send(response);
+}
+
+void handleModelActivate(AsyncWebServerRequest *request) {
+    // Switches between models already on the device: ?slot=0, ?slot=1 or ?slot=builtin
+    if (!request->hasParam("slot")) {
+        request->send(400, "application/json", "{\"error\":\"slot parameter required\"}");
+        return;
+    }
+    String selected = request->getParam("slot")->value();
+    int slot = BUILTIN_MODEL_SLOT;
+    if (selected != "builtin") {
+        size_t number;
+        if (!parseDecimal(selected, number) || number >= MODEL_SLOT_COUNT || !modelSlots[number].valid) {
+            request->send(404, "application/json", "{\"error\":\"no model in that slot\"}");
+            return;
+        }
+        slot = (int)number;
+    }
+    if (modelUploadState.load(std::memory_order_acquire) != MODEL_UPLOAD_IDLE) {
+        request->send(409, "application/json", "{\"error\":\"model upload in progress\"}");
+        return;
+    }
+    activateModel(slot);
+    handleModelInfo(request);
+}
+
+void handleModelUploadBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    if (index == 0) {
+        beginModelUpload(request, total);
+    }
+    if (modelUpload.request != request || modelUpload.staging == nullptr || modelUpload.error.load() != nullptr) {
+        return;
+    }
     
-    // Populate with example values
-    // In a real implementation, these would be the actual values from your trained model
+    // Wait for the recorder task to drain a sector when the ring is full
+    while (index + len - modelUpload.written.load(std::memory_order_acquire) > MODEL_UPLOAD_STAGING_SIZE) {
+        if (xSemaphoreTake(modelUploadDrained, pdMS_TO_TICKS(MODEL_UPLOAD_STALL_MS)) != pdTRUE) {
+            failModelUpload("flash writes fell behind the upload");
+        }
+        if (modelUpload.error.load() != nullptr) {
+            return;
+        }
+    }
+    size_t offset = index % MODEL_UPLOAD_STAGING_SIZE;
+    size_t first = std::min(len, MODEL_UPLOAD_STAGING_SIZE - offset);
+    memcpy(modelUpload.staging + offset, data, first);
+    memcpy(modelUpload.staging, data + first, len - first);
+    modelUpload.received.store(index + len, std::memory_order_release);
     
-    // Feature means and standard deviations for standardization
-    for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
-        svmModel.featureMeans[i] = 0.0;  // Mean of feature i
-        svmModel.featureStds[i] = 1.0;   // Standard deviation of feature i
+    // The recorder task writes whole sectors, and the last partial one
+    if ((index + len) / MODEL_FLASH_SECTOR_SIZE != index / MODEL_FLASH_SECTOR_SIZE || index + len == total) {
+        xTaskNotifyGive(recorderTaskHandle);
+    }
+}
+
+void beginModelUpload(AsyncWebServerRequest *request, size_t total) {
+    if (modelUploadState.load(std::memory_order_acquire) != MODEL_UPLOAD_IDLE) {
+        return;  // Another upload owns the slot; answered with 409
     }
+    modelUpload.request = request;
+    modelUpload.slot = activeModelSlot == 0 ? 1 : 0;
+    modelUpload.size = total;
+    modelUpload.staging = nullptr;
+    modelUpload.received.store(0);
+    modelUpload.written.store(0);
+    modelUpload.released.store(false);
+    modelUpload.error.store(nullptr);
+    modelUpload.slotReleased = false;
+    request->onDisconnect([request]() { abortModelUpload(request); });
     
-    // Support vectors and coefficients
-    for (int i = 0; i < svmModel.numSupportVectors; i++) {
-        svmModel.dualCoefficients[i] = (i % 2 == 0) ? 1.0 : -1.0;  // Alternating signs for example
-        
-        for (int j = 0; j < ECG_BUFFER_SIZE; j++) {
-            // Example support vector values - replace with actual values
-            svmModel.supportVectors[i * ECG_BUFFER_SIZE + j] = 0.1 * i * j;
+    if (total > modelSlotSize) {
+        modelUpload.error.store("model file too large");
+    } else {
+        modelUpload.staging = (uint8_t*)heap_caps_malloc(MODEL_UPLOAD_STAGING_SIZE, MALLOC_CAP_8BIT);
+        if (modelUpload.staging == nullptr) {
+            modelUpload.error.store("not enough memory for the upload");
+        }
+    }
+    modelUploadState.store(MODEL_UPLOAD_RECEIVING, std::memory_order_release);
+}
+
+void failModelUpload(const char* error) {
+    // Keeps the first failure, either task
+    const char* none = nullptr;
+    modelUpload.error.compare_exchange_strong(none, error);
+}
+
+void endModelUpload() {
+    // Web server task: done with the body, answered or not
+    modelUpload.request = nullptr;
+    if (modelUpload.staging == nullptr) {
+        modelUploadState.store(MODEL_UPLOAD_IDLE, std::memory_order_release);
+    } else {
+        // The recorder task frees the ring and reports the outcome
+        modelUpload.released.store(true, std::memory_order_release);
+        xTaskNotifyGive(recorderTaskHandle);
+    }
+}
+
+void abortModelUpload(AsyncWebServerRequest *request) {
+    // Client went away before the upload was answered
+    if (modelUpload.request == request) {
+        failModelUpload("upload aborted");
+        endModelUpload();
+    }
+}
+
+void handleModelUpload(AsyncWebServerRequest *request) {
+    // Runs after the whole body has gone through handleModelUploadBody()
+    if (modelUpload.request != request) {
+        if (request->contentLength() == 0) {
+            request->send(400, "application/json", "{\"error\":\"model file expected in the request body\"}");
+        } else {
+            request->send(409, "application/json", "{\"error\":\"model upload in progress\"}");
+        }
+        return;
+    }
+    const char* error = modelUpload.error.load();
+    if (error != nullptr) {
+        request->send(400, "application/json", "{\"error\":\"" + String(error) + "\"}");
+        endModelUpload();
+        return;
+    }
+    
+    // The recorder task finishes writing and swaps the model in; GET /model reports the outcome
+    modelUpload.request = nullptr;
+    modelUploadState.store(MODEL_UPLOAD_INSTALLING, std::memory_order_release);
+    xTaskNotifyGive(recorderTaskHandle);
+    request->send(202, "application/json", "{\"upload\":\"installing\",\"slot\":" + String(modelUpload.slot) + "}");
+}
+
+void serviceModelUpload() {
+    // Recorder task: writes the staged body to its slot, then activates it
+    if (modelUploadState.load(std::memory_order_acquire) == MODEL_UPLOAD_IDLE || modelUpload.staging == nullptr) {
+        return;
+    }
+    int slot = modelUpload.slot;
+    
+    if (!modelUpload.slotReleased) {
+        // The inactive slot may still be in use for a moment right after a
+        // switch; the ring holds the body meanwhile, try again on the next wake
+        if (modelInUse.load() == &modelSlots[slot].model) {
+            return;
+        }
+        releaseModelSlot(slot);
+        if (modelPartition == nullptr) {
+            SPIFFS.mkdir("/model");
+            modelUpload.file = SPIFFS.open("/model/slot" + String(slot) + ".bin", "w");
+            if (!modelUpload.file) {
+                failModelUpload("cannot create model file");
+            }
+        }
+        modelUpload.slotReleased = true;
+    }
+    
+    // One sector per step: erase, write, then yield
+    while (modelUpload.error.load() == nullptr) {
+        size_t written = modelUpload.written.load(std::memory_order_relaxed);
+        size_t chunk = std::min(modelUpload.received.load(std::memory_order_acquire) - written, MODEL_FLASH_SECTOR_SIZE);
+        if (chunk == 0 || (chunk < MODEL_FLASH_SECTOR_SIZE && written + chunk < modelUpload.size)) {
+            break;  // Sector not staged yet
+        }
+        const uint8_t* source = modelUpload.staging + written % MODEL_UPLOAD_STAGING_SIZE;
+        if (modelPartition != nullptr) {
+            size_t address = slot * modelSlotSize + written;
+            if (esp_partition_erase_range(modelPartition, address, MODEL_FLASH_SECTOR_SIZE) != ESP_OK) {
+                failModelUpload("flash erase failed");
+            } else if (esp_partition_write(modelPartition, address, source, chunk) != ESP_OK) {
+                failModelUpload("flash write failed");
+            }
+        } else if (modelUpload.file.write(source, chunk) != chunk) {
+            failModelUpload("file write failed");
+        }
+        modelUpload.written.store(written + chunk, std::memory_order_release);
+        xSemaphoreGive(modelUploadDrained);
+        vTaskDelay(1);  // Sampling, inference and the network run between sectors
+    }
+    
+    // Finished once the web server task is done with the ring
+    bool installing = modelUploadState.load(std::memory_order_acquire) == MODEL_UPLOAD_INSTALLING;
+    if (!installing && !modelUpload.released.load(std::memory_order_acquire)) {
+        return;
+    }
+    if (modelUpload.file) {
+        modelUpload.file.close();
+    }
+    heap_caps_free(modelUpload.staging);
+    modelUpload.staging = nullptr;
+    
+    // Validated where inference will read it from, then swapped in
+    const char* error = modelUpload.error.load();
+    if (error == nullptr && loadModelSlot(slot, error)) {
+        activateModel(slot);
+    } else {
+        Serial.printf("Model upload to slot %d failed: %s\n", slot, error);
+    }
+    lastModelUploadError = error;
+    modelUploadState.store(MODEL_UPLOAD_IDLE, std::memory_order_release);
+}
+#endif
+
+void setupSampler() {
+    // The pattern cycles through the channels, one conversion each
+    adc_digi_pattern_config_t patterns[ECG_CHANNEL_COUNT] = {};
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        adc_unit_t unit;
+        if (adc_continuous_io_to_channel(ECG_CHANNEL_PINS[c].ecg, &unit, &acquisitionChannels[c].adcChannel) != ESP_OK ||
+            unit != ADC_UNIT_1) {
+            Serial.printf("ECG pin of channel %d is not an ADC1 channel\n", c);
+            return;
+        }
+        patterns[c].atten = ADC_ATTEN_DB_12;
+        patterns[c].channel = acquisitionChannels[c].adcChannel;
+        patterns[c].unit = ADC_UNIT_1;
+        patterns[c].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    }
+    
+    adc_continuous_handle_cfg_t handleConfig = {};
+    handleConfig.max_store_buf_size = ADC_POOL_BYTES;
+    handleConfig.conv_frame_size = ADC_FRAME_BYTES;
+    if (adc_continuous_new_handle(&handleConfig, &adcHandle) != ESP_OK) {
+        Serial.println("Failed to create ADC continuous handle");
+        return;
+    }
+    
+    adc_continuous_config_t adcConfig = {};
+    adcConfig.pattern_num = ECG_CHANNEL_COUNT;
+    adcConfig.adc_pattern = patterns;
+    adcConfig.sample_freq_hz = ADC_SAMPLE_FREQ;
+    adcConfig.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    adcConfig.format = ADC_OUTPUT_TYPE;
+    
+    // Count frames the driver throws away when nobody reads them in time
+    adc_continuous_evt_cbs_t callbacks = {};
+    callbacks.on_pool_ovf = onAdcPoolOverflow;
+    if (adc_continuous_register_event_callbacks(adcHandle, &callbacks, nullptr) != ESP_OK) {
+        Serial.println("Failed to register ADC callbacks, DMA overflows will not be counted");
+    }
+    
+    if (adc_continuous_config(adcHandle, &adcConfig) != ESP_OK ||
+        adc_continuous_start(adcHandle) != ESP_OK) {
+        Serial.println("Failed to start ADC continuous mode");
+        return;
+    }
+    Serial.println("ADC sampling engine started");
+}
+
+bool IRAM_ATTR onAdcPoolOverflow(adc_continuous_handle_t handle, const adc_continuous_evt_data_t* data, void* context) {
+    adcPoolOverflows.fetch_add(1, std::memory_order_relaxed);
+    return false;  // No task woken
+}
+
+bool readSampleBlock(uint16_t (*samples)[SAMPLE_BLOCK_SIZE], size_t* sampleCounts, uint32_t timeoutMs) {
+    // Read no more conversions than are needed to produce SAMPLE_BLOCK_SIZE
+    // samples on the channel furthest along, so partially decimated samples
+    // carry over to the next call. The pattern interleaves the channels, so
+    // a read of whole pattern cycles gives each of them the same share.
+    // Once conversions have arrived the CPU frequency is held, before anything
+    // is measured; the caller releases it.
+    int furthest = 0;
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        sampleCounts[c] = 0;
+        if (acquisitionChannels[c].decimatorCount > furthest) {
+            furthest = acquisitionChannels[c].decimatorCount;
         }
     }
+    uint32_t wanted = (SAMPLE_BLOCK_SIZE * ADC_OVERSAMPLING - furthest) * ECG_CHANNEL_COUNT * SOC_ADC_DIGI_RESULT_BYTES;
+    if (wanted > ADC_FRAME_BYTES) {
+        wanted = ADC_FRAME_BYTES;
+    }
+    
+    uint32_t bytesRead = 0;
+    if (adcHandle == nullptr ||
+        adc_continuous_read(adcHandle, adcFrame, wanted, &bytesRead, timeoutMs) != ESP_OK) {
+        return false;
+    }
     
-    Serial.println("SVM model initialized");
+    holdCpuFrequency();
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (uint32_t i = 0; i < bytesRead; i += SOC_ADC_DIGI_RESULT_BYTES) {
+        adc_digi_output_data_t* result = (adc_digi_output_data_t*)&adcFrame[i];
+        int c = 0;
+        while (c < ECG_CHANNEL_COUNT && ADC_GET_CHANNEL(result) != acquisitionChannels[c].adcChannel) {
+            c++;
+        }
+        if (c == ECG_CHANNEL_COUNT || sampleCounts[c] == SAMPLE_BLOCK_SIZE) {
+            continue;
+        }
+        
+        // Average ADC_OVERSAMPLING conversions into one ECG sample
+        AcquisitionChannel& channel = acquisitionChannels[c];
+        channel.decimatorSum += ADC_GET_DATA(result);
+        if (++channel.decimatorCount == ADC_OVERSAMPLING) {
+            samples[c][sampleCounts[c]++] = channel.decimatorSum / ADC_OVERSAMPLING;
+            channel.decimatorSum = 0;
+            channel.decimatorCount = 0;
+        }
+    }
+    stageCycles[STAGE_SAMPLING].record(esp_cpu_get_cycle_count() - start);
+    return true;
 }
 
 void setupSPIFFS() {
@@ -204,46 +1597,72 @@ void setupSPIFFS() {
 }
 
 void setupWiFi() {
-    Serial.println();
     Serial.print("Connecting to ");
     Serial.println(ssid);
     
+    // Returns at once; onWiFiEvent() takes it from here
+    WiFi.onEvent(onWiFiEvent);
+    WiFi.setAutoReconnect(false);  // Reconnects are paced by onWiFiEvent()
     WiFi.begin(ssid, password);
-    
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        Serial.print(".");
+}
+
+void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    switch (event) {
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            Serial.print("WiFi connected, IP address: ");
+            Serial.println(WiFi.localIP());
+            if (!webServerStarted) {
+                server.begin();
+                webServerStarted = true;
+                Serial.println("HTTP server started");
+            }
+            break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            // Also raised for every failed attempt, so this retries until the network is back
+            Serial.printf("WiFi disconnected (reason %d), retrying in %u ms\n",
+                          info.wifi_sta_disconnected.reason, (unsigned)WIFI_RECONNECT_DELAY_MS);
+            wifiReconnectTimer.once_ms(WIFI_RECONNECT_DELAY_MS, reconnectWiFi);
+            break;
+        default:
+            break;
     }
-    
-    Serial.println("");
-    Serial.println("WiFi connected");
-    Serial.println("IP address: ");
-    Serial.println(WiFi.localIP());
+}
+
+void reconnectWiFi() {
+    WiFi.reconnect();
 }
 
 void setupWebServer() {
     // WebSocket event handler
+    wsClientsLock = xSemaphoreCreateMutex();
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+    modelUploadDrained = xSemaphoreCreateBinary();
+#endif
     ws.onEvent(onWebSocketEvent);
     server.addHandler(&ws);
     
-    // Route for root / web page
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(SPIFFS, "/index.html", "text/html");
-    });
+    // Recorded ECG: file list and raw block downloads
+    server.on("/recordings", HTTP_GET, handleRecordingList);
+    server.on("/recording", HTTP_GET, handleRecordingDownload);
+    
+    // Hot-path profile and health, for Prometheus scrapes
+    server.on("/metrics", HTTP_GET, handleMetrics);
     
-    // Route for style.css
-    server.on("/style.css", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(SPIFFS, "/style.css", "text/css");
-    });
+    // Per-patient calibration: POST /calibration?channel=N&action=start|clear
+    server.on("/calibration", HTTP_GET, handleCalibrationInfo);
+    server.on("/calibration", HTTP_POST, handleCalibrationCommand);
     
-    // Route for script.js
-    server.on("/script.js", HTTP_GET, [](AsyncWebServerRequest *request) {
-        request->send(SPIFFS, "/script.js", "text/javascript");
-    });
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+    // Runtime models; /model also matches its subpaths, so /model/activate goes first
+    server.on("/model/activate", HTTP_POST, handleModelActivate);
+    server.on("/model", HTTP_GET, handleModelInfo);
+    server.on("/model", HTTP_POST, handleModelUpload, nullptr, handleModelUploadBody);
+#endif
     
-    // Start server
-    server.begin();
-    Serial.println("HTTP server started");
+    // Web interface: every file of the gzipped asset directory
+    server.addHandler(new GzipAssetHandler(WEB_ROOT, "index.html"));
+    
+    // onWiFiEvent() starts the server once there is an IP address
 }
 
 void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, 
@@ -251,132 +1670,1211 @@ void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
     switch (type) {
         case WS_EVT_CONNECT:
             Serial.printf("WebSocket client #%u connected from %s\n", client->id(), client->remoteIP().toString().c_str());
+            if (!addWsClient(client)) {
+                Serial.println("Too many WebSocket clients, connection refused");
+                client->close();
+                break;
+            }
             // Send initial data
-            client->text("{\"type\":\"calories\",\"value\":" + String(dailyCalories, 1) + 
-                        ",\"heartRate\":" + String(heartRate, 1) + "}");
+            for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+                WsMessage message;
+                if (formatWsMessage(message, CALORIES_MESSAGE_FORMAT, c, channels[c].dailyCalories, channels[c].heartRate)) {
+                    client->text(message.text, message.length);
+                }
+            }
             break;
         case WS_EVT_DISCONNECT:
             Serial.printf("WebSocket client #%u disconnected\n", client->id());
+            removeWsClient(client);
             break;
-        case WS_EVT_DATA:
-            // Handle any incoming messages from clients
+        case WS_EVT_DATA: {
+            // Subscription requests are short text messages in a single frame
+            AwsFrameInfo* info = (AwsFrameInfo*)arg;
+            StreamTier tier;
+            if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT &&
+                parseSubscription((const char*)data, len, tier)) {
+                if (!wsSubscriptions.push({client->id(), tier})) {
+                    Serial.println("Subscription queue full, request dropped");
+                }
+            }
             break;
+        }
         case WS_EVT_ERROR:
             Serial.printf("WebSocket error for client #%u\n", client->id());
             break;
     }
 }
 
-void processECGData() {
-    // Create a copy of the current ECG buffer
-    std::vector<float> currentECG(ECG_BUFFER_SIZE);
-    
-    // Reconstruct buffer in correct order (since we use a circular buffer)
-    for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
-        int idx = (bufferIndex + i) % ECG_BUFFER_SIZE;
-        currentECG[i] = ecgBuffer[idx];
+bool addWsClient(AsyncWebSocketClient* client) {
+    // async_tcp task; closes the oldest client beyond MAX_WS_CLIENTS, which
+    // stays registered until its disconnect event
+    AsyncWebSocketClient* oldest = nullptr;
+    xSemaphoreTake(wsClientsLock, portMAX_DELAY);
+    int count = wsClientCount.load();
+    bool added = count <= MAX_WS_CLIENTS;
+    if (added) {
+        wsClients[count] = client;
+        wsClientCount.store(++count);
+        if (count > MAX_WS_CLIENTS) {
+            oldest = wsClients[0];
+        }
     }
+    xSemaphoreGive(wsClientsLock);
     
-    // Calculate heart rate from ECG data
-    float newHeartRate = calculateHeartRate(currentECG);
-    if (newHeartRate > 0) {
-        heartRate = 0.7 * heartRate + 0.3 * newHeartRate; // Smoothing
+    // Outside the lock, in case the disconnect event comes back synchronously;
+    // only this task frees clients, so the pointer stays valid
+    if (oldest != nullptr) {
+        oldest->close();
+    }
+    return added;
+}
+
+void removeWsClient(AsyncWebSocketClient* client) {
+    // async_tcp task, before the library frees the client
+    xSemaphoreTake(wsClientsLock, portMAX_DELAY);
+    int count = wsClientCount.load();
+    for (int i = 0; i < count; i++) {
+        if (wsClients[i] == client) {
+            for (int j = i + 1; j < count; j++) {
+                wsClients[j - 1] = wsClients[j];
+            }
+            wsClientCount.store(count - 1);
+            break;
+        }
+    }
+    xSemaphoreGive(wsClientsLock);
+}
+
+void queueStreamSample(int channel, const EcgSample& sample) {
+    StreamBatch& streamBatch = channels[channel].streamBatch;
+    StreamFrameHeader& header = streamBatch.header;
+    
+    // A frame only holds consecutive samples; start a new one after a gap
+    if (header.count > 0 && sample.sequence != header.sequence + header.count) {
+        flushStreamBatch(channel);
     }
     
-    // Detect anomalies
-    bool isAnomaly = detectAnomaly(currentECG);
-    
-    // If anomaly detected and cooldown period passed, trigger alert
-    if (isAnomaly && (millis() - lastAnomalyTime > ANOMALY_COOLDOWN)) {
-        Serial.println("Anomaly detected!");
-        lastAnomalyTime = millis();
+    if (header.count == 0) {
+        header.sequence = sample.sequence;
+        header.timestamp = (uint32_t)((uint64_t)sample.sequence * 1000 / SAMPLING_RATE);
+        channels[channel].streamBatchStart = millis();
+    }
+    streamBatch.samples[header.count++] = sample.raw;
+    
+    if (header.count == STREAM_BATCH_MAX_SAMPLES) {
+        flushStreamBatch(channel);
+    }
+}
+
+void flushStreamBatch(int channel) {
+    StreamBatch& streamBatch = channels[channel].streamBatch;
+    StreamFrameHeader& header = streamBatch.header;
+    header.type = STREAM_FRAME_ECG;
+    header.decimation = 1;
+    header.span = header.count;  // Shared by the reduced frames, which cover the same samples
+    
+    if (wsClientCount.load() > 0) {
+        // Decimated copy for clients that are falling behind
+        StreamFrameHeader& reduced = reducedBatch.header;
+        reduced = header;
+        reduced.decimation = WS_SLOW_CLIENT_DECIMATION;
+        reduced.count = 0;
+        for (int i = 0; i < header.count; i += WS_SLOW_CLIENT_DECIMATION) {
+            reducedBatch.samples[reduced.count++] = streamBatch.samples[i];
+        }
+        
+        // Min/max pairs for trend views; a batch cut short by a gap ends in a partial bucket
+        StreamFrameHeader& minMax = minMaxBatch.header;
+        minMax = header;
+        minMax.type = STREAM_FRAME_MINMAX;
+        minMax.decimation = WS_MINMAX_BUCKET;
+        minMax.count = 0;
+        for (int i = 0; i < header.count; i += WS_MINMAX_BUCKET) {
+            int16_t low = streamBatch.samples[i];
+            int16_t high = low;
+            for (int j = i + 1; j < i + WS_MINMAX_BUCKET && j < header.count; j++) {
+                int16_t value = streamBatch.samples[j];
+                if (value < low) {
+                    low = value;
+                }
+                if (value > high) {
+                    high = value;
+                }
+            }
+            minMaxBatch.samples[minMax.count++] = low;
+            minMaxBatch.samples[minMax.count++] = high;
+        }
+        
+        uint32_t start = esp_cpu_get_cycle_count();
+        broadcastStreamFrame(streamBatch, reducedBatch, minMaxBatch);
+        stageCycles[STAGE_WS_SEND].record(esp_cpu_get_cycle_count() - start);
+    }
+    header.count = 0;
+}
+
+void broadcastStreamFrame(const StreamBatch& full, const StreamBatch& reduced, const StreamBatch& minMax) {
+    unsigned long now = millis();
+    for (int i = 0; i <= MAX_WS_CLIENTS; i++) {
+        wsClientStates[i].seen = false;
+    }
+    
+    xSemaphoreTake(wsClientsLock, portMAX_DELAY);
+    int count = wsClientCount.load();
+    for (int c = 0; c < count; c++) {
+        AsyncWebSocketClient* client = wsClients[c];
+        if (client->status() != WS_CONNECTED) {
+            continue;
+        }
+        WsClientState* state = wsClientState(client->id());
+        if (state == nullptr) {
+            continue;  // More clients than slots; cleanupClients() will close the extra ones
+        }
+        state->seen = true;
+        if (state->tier == STREAM_TIER_VITALS) {
+            state->stalledSince = 0;
+            continue;
+        }
+        
+        // Min/max frames are already small, lagging subscribers keep getting them
+        const StreamBatch& frame = state->tier == STREAM_TIER_MINMAX ? minMax : full;
+        const StreamBatch& lagging = state->tier == STREAM_TIER_MINMAX ? minMax : reduced;
+        size_t queued = client->queueLen();
+        if (queued < WS_QUEUE_THROTTLE_DEPTH) {
+            client->binary((const uint8_t*)&frame, streamFrameLength(frame));
+            state->stalledSince = 0;
+        } else if (queued < WS_QUEUE_SKIP_DEPTH && !client->queueIsFull()) {
+            client->binary((const uint8_t*)&lagging, streamFrameLength(lagging));
+            state->stalledSince = 0;
+            if (&lagging == &reduced) {
+                wsFramesDecimated++;
+            }
+        } else {
+            // Too far behind: skip this frame, and give up on the client if it stays stuck
+            wsFramesSkipped++;
+            if (state->stalledSince == 0) {
+                state->stalledSince = now;
+            } else if (now - state->stalledSince > WS_STALL_TIMEOUT_MS) {
+                Serial.printf("WebSocket client #%u too slow, disconnecting\n", client->id());
+                client->close();
+                wsSlowClientsDropped++;
+            }
+        }
+    }
+    xSemaphoreGive(wsClientsLock);
+    
+    // Release the state of clients that have gone away
+    for (int i = 0; i <= MAX_WS_CLIENTS; i++) {
+        if (!wsClientStates[i].seen) {
+            wsClientStates[i].inUse = false;
+        }
+    }
+}
+
+size_t streamFrameLength(const StreamBatch& batch) {
+    return sizeof(StreamFrameHeader) + batch.header.count * sizeof(int16_t);
+}
+
+bool parseSubscription(const char* text, size_t length, StreamTier& tier) {
+    // Only {"subscribe":"<tier>"} is understood, so a key search is enough
+    char message[WS_SUBSCRIPTION_MAX_LENGTH];
+    if (length >= sizeof(message)) {
+        return false;
+    }
+    memcpy(message, text, length);
+    message[length] = '\0';
+    
+    const char* key = strstr(message, "\"subscribe\"");
+    if (key == nullptr) {
+        return false;
+    }
+    const char* value = strchr(key + strlen("\"subscribe\""), '"');
+    if (value == nullptr) {
+        return false;
+    }
+    value++;
+    for (int t = 0; t < STREAM_TIER_COUNT; t++) {
+        size_t nameLength = strlen(STREAM_TIER_NAMES[t]);
+        if (strncmp(value, STREAM_TIER_NAMES[t], nameLength) == 0 && value[nameLength] == '"') {
+            tier = (StreamTier)t;
+            return true;
+        }
+    }
+    return false;
+}
+
+void applyWsSubscriptions() {
+    WsSubscription subscription;
+    while (wsSubscriptions.pop(subscription)) {
+        WsClientState* state = wsClientState(subscription.clientId);
+        if (state != nullptr) {
+            state->tier = subscription.tier;
+            Serial.printf("WebSocket client #%u subscribed to %s\n", subscription.clientId,
+                          STREAM_TIER_NAMES[subscription.tier]);
+        }
+    }
+}
+
+void broadcastVitals() {
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        const ChannelState& channel = channels[c];
+        unsigned rrIntervalMs = channel.rrInterval * 1000u / SAMPLING_RATE;
+        const HrvStats& hrv = channel.hrv;
+        broadcastWsMessage(VITALS_MESSAGE_FORMAT, c, channel.heartRate, rrIntervalMs, hrv.sdnn(), hrv.rmssd(),
+                           hrv.pnn50(), hrv.irregularity(), (unsigned)channel.anomalyCount,
+                           leadsOff(c) ? "true" : "false");
+    }
+}
+
+bool formatWsMessage(WsMessage& message, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    bool formatted = formatWsMessageV(message, format, args);
+    va_end(args);
+    return formatted;
+}
+
+void broadcastWsMessage(const char* format, ...) {
+    WsMessage message;
+    va_list args;
+    va_start(args, format);
+    bool formatted = formatWsMessageV(message, format, args);
+    va_end(args);
+    if (!formatted || wsClientCount.load() == 0) {
+        return;
+    }
+    xSemaphoreTake(wsClientsLock, portMAX_DELAY);
+    int count = wsClientCount.load();
+    for (int c = 0; c < count; c++) {
+        if (wsClients[c]->status() == WS_CONNECTED) {
+            wsClients[c]->text(message.text, message.length);
+        }
+    }
+    xSemaphoreGive(wsClientsLock);
+}
+
+bool formatWsMessageV(WsMessage& message, const char* format, va_list args) {
+    int length = vsnprintf(message.text, sizeof(message.text), format, args);
+    if (length < 0 || (size_t)length >= sizeof(message.text)) {
+        // A truncated message would be invalid JSON, drop it instead
+        wsMessagesTooLong.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    message.length = length;
+    return true;
+}
+
+WsClientState* wsClientState(uint32_t clientId) {
+    WsClientState* freeSlot = nullptr;
+    for (int i = 0; i <= MAX_WS_CLIENTS; i++) {
+        WsClientState& state = wsClientStates[i];
+        if (state.inUse && state.id == clientId) {
+            return &state;
+        }
+        if (!state.inUse && freeSlot == nullptr) {
+            freeSlot = &state;
+        }
+    }
+    if (freeSlot != nullptr) {
+        freeSlot->inUse = true;
+        freeSlot->id = clientId;
+        freeSlot->tier = STREAM_TIER_RAW;
+        freeSlot->stalledSince = 0;
+    }
+    return freeSlot;
+}
+
+void processECGData(int channel, const EcgSample& sample) {
+    ChannelState& state = channels[channel];
+    float voltage = sample.filtered * FILTERED_TO_VOLTS;
+    
+    // Stream every sample to WebSocket clients in batched binary frames
+    queueStreamSample(channel, sample);
+    
+    // Compress into the flash recording
+    recordSample(channel, sample);
+    
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_BEAT
+    // One classification per heartbeat, on the beat-aligned segment, batched
+    // with the other channels' beats
+    bool segmentReady = state.beatSegmenter.addSample(sample, voltage);
+    if (state.beatSegmenter.droppedBeats() != state.beatsDroppedSeen) {
+        beatsDropped.fetch_add(state.beatSegmenter.droppedBeats() - state.beatsDroppedSeen, std::memory_order_relaxed);
+        state.beatsDroppedSeen = state.beatSegmenter.droppedBeats();
+    }
+    if (segmentReady) {
+        if (windowPending[channel]) {
+            classifyPendingWindows();  // Backlog: a second beat of this channel in one wake
+        }
+        const float* segment = state.beatSegmenter.segment();
+        const float* offsets = calibrationOffsets[channel];
+        for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+            standardizedWindows[channel][i] = processingModel->standardize(segment[i] - offsets[i], i);
+        }
+        windowPending[channel] = true;
+        if (calibrationSessions[channel].active) {
+            calibrateBeat(channel, segment);
+        }
+    }
+#else
+    // Overlapping windows are classified every ANOMALY_HOP_SIZE samples (~30ms);
+    // only the calls that complete a window count as a decision
+    uint32_t start = esp_cpu_get_cycle_count();
+    if (state.slidingDetector.addSample(voltage)) {
+        stageCycles[STAGE_ANOMALY].record(esp_cpu_get_cycle_count() - start);
+        if (state.slidingDetector.lastWindowAnomalous()) {
+            reportAnomaly(channel);
+        }
+    }
+#endif
+    
+    // Heart rate from the R-R intervals found by the QRS detector
+    if (sample.rrInterval > 0) {
+        state.rrInterval = sample.rrInterval;
+        state.hrv.add(sample.rrInterval);
+        float newHeartRate = 60.0f * SAMPLING_RATE / sample.rrInterval;
+        state.heartRate = 0.7 * state.heartRate + 0.3 * newHeartRate; // Smoothing
+    }
+}
+
+void classifyPendingWindows() {
+    // One pass over the model for every beat window waiting in the batch
+    const float* windows[ECG_CHANNEL_COUNT];
+    float thresholds[ECG_CHANNEL_COUNT];
+    int windowChannels[ECG_CHANNEL_COUNT];
+    int count = 0;
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        if (windowPending[c]) {
+            windows[count] = standardizedWindows[c];
+            thresholds[count] = calibrations[c].threshold;
+            windowChannels[count++] = c;
+            windowPending[c] = false;
+        }
+    }
+    if (count == 0) {
+        return;
+    }
+    
+    bool anomalous[ECG_CHANNEL_COUNT];
+    uint32_t start = esp_cpu_get_cycle_count();
+    detectAnomalies(windows, count, anomalous, thresholds);
+    stageCycles[STAGE_ANOMALY].record(esp_cpu_get_cycle_count() - start);
+    for (int b = 0; b < count; b++) {
+        if (anomalous[b]) {
+            reportAnomaly(windowChannels[b]);
+        }
+    }
+}
+
+void reportAnomaly(int channel) {
+    // If this channel's cooldown period passed, trigger alert
+    ChannelState& state = channels[channel];
+    if (millis() - state.lastAnomalyTime > ANOMALY_COOLDOWN) {
+        Serial.printf("Anomaly detected on channel %d!\n", channel);
+        state.lastAnomalyTime = millis();
+        state.anomalyCount++;
+        state.recordEventPending = true;  // Marks the current record block as an event trigger
         anomalyDetected = true;
+        lastBuzzerTime = state.lastAnomalyTime;
         digitalWrite(BUZZER_PIN, HIGH);
         
         // Notify clients
-        String anomalyData = "{\"type\":\"anomaly\",\"timestamp\":" + String(millis()) + "}";
-        ws.textAll(anomalyData);
+        broadcastWsMessage("{\"type\":\"anomaly\",\"channel\":%d,\"timestamp\":%lu}", channel, millis());
+    }
+}
+
+void recordSample(int channel, const EcgSample& sample) {
+    RecordBlockEncoder& encoder = channels[channel].recordEncoder;
+    if (!encoder.accepts(sample)) {
+        submitRecordBlock(channel);
+    }
+    encoder.add(sample, millis());
+}
+
+void submitRecordBlock(int channel) {
+    ChannelState& state = channels[channel];
+    RecordBlock& block = state.recordEncoder.block();
+    block.header.channel = channel;
+    if (state.recordEventPending) {
+        block.header.flags |= RECORD_FLAG_EVENT;
+        state.recordEventPending = false;
+    }
+    if (recordRing.push(block)) {
+        xTaskNotifyGive(recorderTaskHandle);
+        uint32_t depth = recordRing.size();
+        if (depth > recordRingHighWater.load(std::memory_order_relaxed)) {
+            recordRingHighWater.store(depth, std::memory_order_relaxed);
+        }
+    } else {
+        recordBlocksDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (uploaderTaskHandle != nullptr) {
+        if (!uploadRing.push(block)) {
+            uploadBlocksDropped.fetch_add(1, std::memory_order_relaxed);
+        } else if (block.header.flags & RECORD_FLAG_EVENT) {
+            xTaskNotifyGive(uploaderTaskHandle);  // Events are sent without waiting for the batch
+        }
+    }
+    state.recordEncoder.clear();
+}
+
+void recorderTask(void* parameter) {
+    setupRecorder();
+    
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RECORDER_WAKE_INTERVAL_MS));
+        
+        RecordBlock block;
+        while (recordRing.pop(block)) {
+            handleRecordBlock(block);
+        }
+        saveCalibrations();
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+        serviceModelUpload();
+#endif
     }
 }
 
-float calculateHeartRate(const std::vector<float>& ecgData) {
-    // Simple peak detection for heart rate calculation
-    // A more sophisticated algorithm would be used in a real implementation
+void uploaderTask(void* parameter) {
+    WiFiClientSecure client;
+    client.setCACert(collectorCaCert);
+    HTTPClient http;
+    http.setReuse(true);  // Keep the TLS session open between batches
+    http.setConnectTimeout(UPLOAD_TIMEOUT_MS);
+    http.setTimeout(UPLOAD_TIMEOUT_MS);
+    String deviceId = WiFi.macAddress();
     
-    int peakCount = 0;
-    bool rising = false;
-    float threshold = 1.5; // Threshold for peak detection
+    unsigned long batchStart = 0;
+    bool eventPending = false;
+    uint32_t backoff = 0;
+    unsigned long retryAt = 0;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(UPLOADER_WAKE_INTERVAL_MS));
+        
+        // Top up the batch; what does not fit waits in the ring
+        while (uploadBatchCount < UPLOAD_BATCH_BLOCKS && uploadRing.pop(uploadBatch[uploadBatchCount])) {
+            if (uploadBatchCount == 0) {
+                batchStart = millis();
+            }
+            eventPending = eventPending || (uploadBatch[uploadBatchCount].header.flags & RECORD_FLAG_EVENT);
+            uploadBatchCount++;
+        }
+        
+        bool due = uploadBatchCount == UPLOAD_BATCH_BLOCKS || eventPending ||
+                   millis() - batchStart >= UPLOAD_INTERVAL_MS;
+        if (uploadBatchCount == 0 || !due || WiFi.status() != WL_CONNECTED) {
+            continue;
+        }
+        if (backoff > 0 && (long)(millis() - retryAt) < 0) {
+            continue;
+        }
+        
+        holdCpuFrequency();
+        bool sent = postUploadBatch(http, client, deviceId);
+        releaseCpuFrequency();
+        if (sent) {
+            uploadBlocksSent.fetch_add(uploadBatchCount, std::memory_order_relaxed);
+            uploadBatchCount = 0;
+            eventPending = false;
+            backoff = 0;
+        } else {
+            // Jitter keeps a fleet of devices from retrying in lockstep after an outage
+            uploadFailures.fetch_add(1, std::memory_order_relaxed);
+            backoff = backoff == 0 ? UPLOAD_BACKOFF_MIN_MS : backoff * 2;
+            if (backoff > UPLOAD_BACKOFF_MAX_MS) {
+                backoff = UPLOAD_BACKOFF_MAX_MS;
+            }
+            retryAt = millis() + backoff / 2 + esp_random() % (backoff / 2);
+        }
+    }
+}
+
+bool postUploadBatch(HTTPClient& http, WiFiClientSecure& client, const String& deviceId) {
+    if (!http.begin(client, collectorUrl)) {
+        Serial.println("Upload failed: invalid collector URL");
+        return false;
+    }
+    http.addHeader("Content-Type", "application/octet-stream");
+    http.addHeader("X-Device-Id", deviceId);
+    int status = http.POST((uint8_t*)uploadBatch, uploadBatchCount * sizeof(RecordBlock));
+    http.end();  // With reuse enabled the connection stays open if the collector allows it
     
-    for (size_t i = 1; i < ecgData.size(); i++) {
-        if (!rising && ecgData[i] > ecgData[i-1] && ecgData[i] > threshold) {
-            rising = true;
-        } else if (rising && ecgData[i] < ecgData[i-1]) {
-            peakCount++;
-            rising = false;
+    if (status < 200 || status >= 300) {
+        Serial.printf("Upload failed: %s\n", status < 0 ? HTTPClient::errorToString(status).c_str() : String(status).c_str());
+        return false;
+    }
+    return true;
+}
+
+void setupRecorder() {
+    // Continue the circular log after the segment written before the reboot
+    File indexFile = SPIFFS.open("/rec/index", "r");
+    if (indexFile) {
+        int lastSegment = indexFile.parseInt();
+        indexFile.close();
+        segmentNumber = (lastSegment + 1) % RECORD_SEGMENT_COUNT;
+    }
+    openSegment(segmentNumber);
+}
+
+void handleRecordBlock(const RecordBlock& block) {
+    // Event capture: pre-trigger blocks from RAM, then the following blocks
+    if (postTriggerRemaining > 0) {
+        eventFile.write((const uint8_t*)&block, sizeof(block));
+        if (--postTriggerRemaining == 0) {
+            eventFile.close();
+            Serial.printf("Event capture %d saved\n", eventNumber);
+            eventNumber = (eventNumber + 1) % RECORD_EVENT_FILES;
         }
+    } else if (block.header.flags & RECORD_FLAG_EVENT) {
+        startEventCapture(block);
     }
     
-    // Calculate heart rate in BPM
-    // Time window is ECG_BUFFER_SIZE / SAMPLING_RATE seconds
-    float timeWindowInSeconds = (float)ECG_BUFFER_SIZE / SAMPLING_RATE;
-    float heartRate = (peakCount * 60.0) / timeWindowInSeconds;
+    preTriggerBlocks[preTriggerIndex] = block;
+    preTriggerIndex = (preTriggerIndex + 1) % RECORD_PRE_TRIGGER_BLOCKS;
+    if (preTriggerCount < RECORD_PRE_TRIGGER_BLOCKS) {
+        preTriggerCount++;
+    }
     
-    return heartRate;
+    // Circular log, written in batches to limit flash wear and write calls
+    recordWriteBatch[recordBatchCount++] = block;
+    if (recordBatchCount == RECORD_WRITE_BATCH) {
+        writeSegmentBatch();
+    }
 }
 
-float calculateCalories(float heartRate, unsigned long elapsedMinutes) {
-    // Simple calorie calculation - replace with a more accurate formula if needed
-    // This is a rough estimate using heart rate
+void writeSegmentBatch() {
+    if (segmentFile) {
+        segmentFile.write((const uint8_t*)recordWriteBatch, recordBatchCount * sizeof(RecordBlock));
+        segmentFile.flush();
+    }
+    segmentBlocks += recordBatchCount;
+    recordBatchCount = 0;
     
-    // Example formula: calories = average_heart_rate * minutes * factor
-    // where factor depends on gender, age, weight, etc.
-    float factor = 0.1; // Example factor, adjust based on individual
+    if (segmentBlocks >= RECORD_SEGMENT_BLOCKS) {
+        openSegment((segmentNumber + 1) % RECORD_SEGMENT_COUNT);
+    }
+}
+
+void openSegment(int number) {
+    if (segmentFile) {
+        segmentFile.close();
+    }
+    segmentNumber = number;
+    segmentBlocks = 0;
     
-    return heartRate * elapsedMinutes * factor;
+    // Opening for writing truncates the oldest segment
+    String path = "/rec/seg" + String(segmentNumber) + ".bin";
+    segmentFile = SPIFFS.open(path, "w");
+    if (!segmentFile) {
+        Serial.println("Failed to open recording segment " + path);
+        return;
+    }
+    
+    File indexFile = SPIFFS.open("/rec/index", "w");
+    if (indexFile) {
+        indexFile.print(segmentNumber);
+        indexFile.close();
+    }
 }
 
-bool detectAnomaly(const std::vector<float>& ecgData) {
-    // Use SVM model to detect anomalies
+void startEventCapture(const RecordBlock& trigger) {
+    String path = "/evt/" + String(eventNumber) + ".bin";
+    eventFile = SPIFFS.open(path, "w");
+    if (!eventFile) {
+        Serial.println("Failed to open event capture " + path);
+        return;
+    }
     
-    // Standardize features first (same as in training)
-    std::vector<float> features = ecgData;
-    standardizeFeatures(features);
+    // Oldest pre-trigger block first
+    int start = (preTriggerIndex - preTriggerCount + RECORD_PRE_TRIGGER_BLOCKS) % RECORD_PRE_TRIGGER_BLOCKS;
+    for (int i = 0; i < preTriggerCount; i++) {
+        const RecordBlock& block = preTriggerBlocks[(start + i) % RECORD_PRE_TRIGGER_BLOCKS];
+        eventFile.write((const uint8_t*)&block, sizeof(block));
+    }
+    eventFile.write((const uint8_t*)&trigger, sizeof(trigger));
+    postTriggerRemaining = RECORD_POST_TRIGGER_BLOCKS;
+}
+
+bool GzipAssetHandler::canHandle(AsyncWebServerRequest *request) {
+    if (request->method() != HTTP_GET) {
+        return false;
+    }
+    String path = assetPath(request);
+    return path.length() > 0 && SPIFFS.exists(path.c_str());
+}
+
+void GzipAssetHandler::handleRequest(AsyncWebServerRequest *request) {
+    String path = assetPath(request);
+    File file = SPIFFS.open(path, "r");
+    if (!file || file.size() < 8) {
+        request->send(404);
+        return;
+    }
     
-    // SVM prediction with RBF kernel
-    float decision = svmModel.bias;
+    // The gzip trailer holds the CRC32 and length of the uncompressed content
+    uint8_t trailer[8];
+    file.seek(file.size() - sizeof(trailer));
+    file.read(trailer, sizeof(trailer));
+    file.close();
+    char etag[20];
+    snprintf(etag, sizeof(etag), "\"%02x%02x%02x%02x-%02x%02x%02x%02x\"",
+             trailer[3], trailer[2], trailer[1], trailer[0], trailer[7], trailer[6], trailer[5], trailer[4]);
     
-    // For each support vector
-    for (int i = 0; i < svmModel.numSupportVectors; i++) {
-        // Extract support vector
-        std::vector<float> supportVector(ECG_BUFFER_SIZE);
-        for (int j = 0; j < ECG_BUFFER_SIZE; j++) {
-            supportVector[j] = svmModel.supportVectors[i * ECG_BUFFER_SIZE + j];
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", WEB_CACHE_CONTROL);
+        request->send(response);
+        return;
+    }
+    
+    // Every browser the dashboard supports accepts gzip, so no plain fallback is stored
+    String uncompressed = path.substring(0, path.length() - 3);
+    AsyncWebServerResponse* response = request->beginResponse(SPIFFS, path, contentType(uncompressed));
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", WEB_CACHE_CONTROL);
+    response->addHeader("Vary", "Accept-Encoding");
+    request->send(response);
+}
+
+String GzipAssetHandler::assetPath(AsyncWebServerRequest *request) const {
+    String url = request->url();
+    if (url.indexOf("..") >= 0) {
+        return "";
+    }
+    if (url.endsWith("/")) {
+        url += defaultFile;
+    }
+    return root + url + ".gz";
+}
+
+const char* GzipAssetHandler::contentType(const String& path) {
+    if (path.endsWith(".html")) return "text/html";
+    if (path.endsWith(".css")) return "text/css";
+    if (path.endsWith(".js")) return "text/javascript";
+    if (path.endsWith(".json")) return "application/json";
+    if (path.endsWith(".svg")) return "image/svg+xml";
+    if (path.endsWith(".png")) return "image/png";
+    if (path.endsWith(".ico")) return "image/x-icon";
+    return "application/octet-stream";
+}
+
+void handleRecordingList(AsyncWebServerRequest *request) {
+    // Small fixed-size list, printed straight into the response buffer
+    AsyncResponseStream* response = request->beginResponseStream("application/json");
+    response->printf("{\"blockSize\":%u,\"current\":\"seg%d\",\"files\":[", (unsigned)RECORD_BLOCK_SIZE, segmentNumber);
+    bool first = true;
+    for (int i = 0; i < RECORD_SEGMENT_COUNT + RECORD_EVENT_FILES; i++) {
+        String name = i < RECORD_SEGMENT_COUNT ? "seg" + String(i) : "evt" + String(i - RECORD_SEGMENT_COUNT);
+        File file = SPIFFS.open(recordingPath(name), "r");
+        if (!file) {
+            continue;
         }
+        response->printf("%s{\"name\":\"%s\",\"size\":%u}", first ? "" : ",", name.c_str(), (unsigned)file.size());
+        file.close();
+        first = false;
+    }
+    response->print("]}");
+    request->send(response);
+}
+
+void handleRecordingDownload(AsyncWebServerRequest *request) {
+    // Without a file parameter the whole circular log is streamed oldest
+    // segment first; its length is not known up front, so it is chunked
+    if (!request->hasParam("file")) {
+        struct LogStream {
+            int next;       // Segments left to open, oldest first
+            int remaining;
+            File file;
+            uint8_t carry[RECORD_BLOCK_SIZE];  // Block being sent, across calls
+            size_t carryOffset;
+            size_t carryLength;
+        };
+        std::shared_ptr<LogStream> log = std::make_shared<LogStream>();
+        log->next = (segmentNumber + 1) % RECORD_SEGMENT_COUNT;
+        log->remaining = RECORD_SEGMENT_COUNT;
+        log->carryOffset = log->carryLength = 0;
         
-        // Calculate kernel and add weighted contribution
-        float kernelValue = rbfKernel(features, supportVector, svmModel.gamma);
-        decision += svmModel.dualCoefficients[i] * kernelValue;
+        AsyncWebServerResponse* response = request->beginChunkedResponse("application/octet-stream",
+            [log](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                // Whole blocks are read from the segments, so one still being
+                // written never yields a torn block, and handed out in pieces
+                // as small as the TCP window asks for. 0 ends the stream, so it
+                // is only returned once every segment has been sent.
+                size_t written = 0;
+                while (written < maxLen) {
+                    if (log->carryOffset < log->carryLength) {
+                        size_t length = log->carryLength - log->carryOffset;
+                        if (length > maxLen - written) {
+                            length = maxLen - written;
+                        }
+                        memcpy(buffer + written, log->carry + log->carryOffset, length);
+                        log->carryOffset += length;
+                        written += length;
+                        continue;
+                    }
+                    if (log->file) {
+                        if (log->file.read(log->carry, RECORD_BLOCK_SIZE) == RECORD_BLOCK_SIZE) {
+                            log->carryOffset = 0;
+                            log->carryLength = RECORD_BLOCK_SIZE;
+                            continue;
+                        }
+                        log->file.close();
+                    }
+                    if (log->remaining == 0) {
+                        break;
+                    }
+                    log->file = SPIFFS.open(recordingPath("seg" + String(log->next)), "r");
+                    log->next = (log->next + 1) % RECORD_SEGMENT_COUNT;
+                    log->remaining--;
+                }
+                return written;
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=\"ecg-log.bin\"");
+        request->send(response);
+        return;
     }
     
-    // Decision boundary: decision < 0 means anomaly
-    return decision < 0;
+    String name = request->getParam("file")->value();
+    String path = recordingPath(name);
+    File file = path.length() > 0 ? SPIFFS.open(path, "r") : File();
+    if (!file) {
+        request->send(404, "text/plain", "Recording not found");
+        return;
+    }
+    
+    // Single files support byte ranges so interrupted downloads can resume
+    size_t size = file.size();
+    size_t start = 0;
+    size_t end = size - 1;
+    bool partial = false;
+    if (request->hasHeader("Range")) {
+        if (!parseByteRange(request->getHeader("Range")->value(), size, start, end)) {
+            AsyncWebServerResponse* response = request->beginResponse(416, "text/plain", "Range not satisfiable");
+            response->addHeader("Content-Range", "bytes */" + String((unsigned)size));
+            request->send(response);
+            return;
+        }
+        partial = true;
+    }
+    
+    size_t length = size > 0 ? end - start + 1 : 0;
+    AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", length,
+        [file, start](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t {
+            // Read straight from flash into the TCP buffer
+            file.seek(start + index);
+            return file.read(buffer, maxLen);
+        });
+    response->addHeader("Accept-Ranges", "bytes");
+    response->addHeader("Content-Disposition", "attachment; filename=\"" + name + ".bin\"");
+    if (partial) {
+        response->setCode(206);
+        response->addHeader("Content-Range", "bytes " + String((unsigned)start) + "-" + String((unsigned)end) +
+                                             "/" + String((unsigned)size));
+    }
+    request->send(response);
+}
+
+String recordingPath(const String& name) {
+    // Only the recorder's own files can be downloaded
+    if (name.length() < 4) {
+        return "";
+    }
+    String prefix = name.substring(0, 3);
+    String number = name.substring(3);
+    for (size_t i = 0; i < number.length(); i++) {
+        if (!isDigit(number[i])) {
+            return "";
+        }
+    }
+    int index = number.toInt();
+    if (prefix == "seg" && index < RECORD_SEGMENT_COUNT) {
+        return "/rec/seg" + number + ".bin";
+    }
+    if (prefix == "evt" && index < RECORD_EVENT_FILES) {
+        return "/evt/" + number + ".bin";
+    }
+    return "";
+}
+
+bool parseDecimal(const String& text, size_t& value) {
+    // Digits only, unlike toInt(), which stops at the first non-digit and reads "abc" as 0
+    if (text.length() == 0) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = 0; i < text.length(); i++) {
+        if (!isDigit(text[i]) || value > (SIZE_MAX - 9) / 10) {
+            return false;
+        }
+        value = value * 10 + (text[i] - '0');
+    }
+    return true;
+}
+
+bool parseByteRange(const String& range, size_t size, size_t& start, size_t& end) {
+    // Single ranges only: "bytes=a-b", "bytes=a-" or "bytes=-n"
+    if (!range.startsWith("bytes=") || range.indexOf(',') >= 0 || size == 0) {
+        return false;
+    }
+    int dash = range.indexOf('-');
+    if (dash < 0) {
+        return false;
+    }
+    String first = range.substring(6, dash);
+    String last = range.substring(dash + 1);
+    if (first.length() == 0) {
+        // Suffix range: the last n bytes
+        size_t suffix;
+        if (!parseDecimal(last, suffix) || suffix == 0) {
+            return false;
+        }
+        start = suffix >= size ? 0 : size - suffix;
+        end = size - 1;
+        return true;
+    }
+    if (!parseDecimal(first, start)) {
+        return false;
+    }
+    if (last.length() == 0) {
+        end = size - 1;
+    } else if (!parseDecimal(last, end)) {
+        return false;
+    }
+    if (end >= size) {
+        end = size - 1;
+    }
+    return start <= end;
 }
 
-float rbfKernel(const std::vector<float>& x1, const std::vector<float>& x2, float gamma) {
-    // Calculate RBF kernel: K(x,y) = exp(-gamma * ||x-y||^2)
-    float squaredDistance = 0.0;
+void handleMetrics(AsyncWebServerRequest *request) {
+    // Prometheus text exposition format, printed straight into the response buffer
+    AsyncResponseStream* response = request->beginResponseStream("text/plain; version=0.0.4");
+    
+    response->print("# HELP ecg_stage_cycles CPU cycles spent per call of each hot-path stage\n");
+    response->print("# TYPE ecg_stage_cycles histogram\n");
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        printHistogram(*response, "ecg_stage_cycles", PROFILE_STAGE_NAMES[i], stageCycles[i]);
+    }
+    response->print("# HELP ecg_stage_max_cycles Longest call of each hot-path stage since boot\n");
+    response->print("# TYPE ecg_stage_max_cycles gauge\n");
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        response->printf("ecg_stage_max_cycles{stage=\"%s\"} %u\n", PROFILE_STAGE_NAMES[i], (unsigned)stageCycles[i].max());
+    }
+    response->print("# HELP ecg_sample_deadline_cycles CPU cycles in one sample period\n");
+    response->print("# TYPE ecg_sample_deadline_cycles gauge\n");
+    response->printf("ecg_sample_deadline_cycles %u\n", (unsigned)sampleDeadlineCycles);
+    
+    response->print("# HELP ecg_samples_total Samples produced by the ADC engine\n");
+    response->print("# TYPE ecg_samples_total counter\n");
+    response->printf("ecg_samples_total %u\n", (unsigned)samplesAcquired.load());
+    response->print("# HELP ecg_late_samples_total Samples handled later than one sample period\n");
+    response->print("# TYPE ecg_late_samples_total counter\n");
+    response->printf("ecg_late_samples_total{task=\"acquisition\"} %u\n", (unsigned)lateAcquisitionSamples.load());
+    response->printf("ecg_late_samples_total{task=\"processing\"} %u\n", (unsigned)lateProcessingSamples.load());
+    response->print("# HELP ecg_missed_samples_total Samples that never reached the processing task\n");
+    response->print("# TYPE ecg_missed_samples_total counter\n");
+    response->printf("ecg_missed_samples_total{reason=\"dma_overflow\"} %u\n",
+                     (unsigned)(adcPoolOverflows.load() * SAMPLE_BLOCK_SIZE * ECG_CHANNEL_COUNT));
+    response->printf("ecg_missed_samples_total{reason=\"ring_full\"} %u\n", (unsigned)droppedSamples.load());
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_BEAT
+    response->print("# HELP ecg_beats_dropped_total Beats not classified because too many segments were pending\n");
+    response->print("# TYPE ecg_beats_dropped_total counter\n");
+    response->printf("ecg_beats_dropped_total %u\n", (unsigned)beatsDropped.load());
+#endif
+    response->print("# HELP ecg_record_blocks_dropped_total Record blocks lost because the recorder fell behind\n");
+    response->print("# TYPE ecg_record_blocks_dropped_total counter\n");
+    response->printf("ecg_record_blocks_dropped_total %u\n", (unsigned)recordBlocksDropped.load());
+    response->print("# HELP ecg_upload_blocks_total Record blocks handled by the collector uploader\n");
+    response->print("# TYPE ecg_upload_blocks_total counter\n");
+    response->printf("ecg_upload_blocks_total{result=\"sent\"} %u\n", (unsigned)uploadBlocksSent.load());
+    response->printf("ecg_upload_blocks_total{result=\"dropped\"} %u\n", (unsigned)uploadBlocksDropped.load());
+    response->print("# HELP ecg_upload_failures_total Upload requests that failed and will be retried\n");
+    response->print("# TYPE ecg_upload_failures_total counter\n");
+    response->printf("ecg_upload_failures_total %u\n", (unsigned)uploadFailures.load());
+    
+    response->print("# HELP ecg_queue_depth Items waiting in each inter-task ring\n");
+    response->print("# TYPE ecg_queue_depth gauge\n");
+    // Each channel has its own sample ring, report the deepest
+    size_t queuedSamples = 0;
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        if (acquisitionChannels[c].samples.size() > queuedSamples) {
+            queuedSamples = acquisitionChannels[c].samples.size();
+        }
+    }
+    response->printf("ecg_queue_depth{queue=\"samples\"} %u\n", (unsigned)queuedSamples);
+    response->printf("ecg_queue_depth{queue=\"record_blocks\"} %u\n", (unsigned)recordRing.size());
+    response->printf("ecg_queue_depth{queue=\"upload_blocks\"} %u\n", (unsigned)uploadRing.size());
+    response->print("# HELP ecg_queue_max_depth Deepest each inter-task ring has been since boot\n");
+    response->print("# TYPE ecg_queue_max_depth gauge\n");
+    response->printf("ecg_queue_max_depth{queue=\"samples\"} %u\n", (unsigned)sampleRingHighWater.load());
+    response->printf("ecg_queue_max_depth{queue=\"record_blocks\"} %u\n", (unsigned)recordRingHighWater.load());
+    response->print("# HELP ecg_queue_capacity Size of each inter-task ring\n");
+    response->print("# TYPE ecg_queue_capacity gauge\n");
+    response->printf("ecg_queue_capacity{queue=\"samples\"} %u\n", (unsigned)SAMPLE_RING_SIZE);
+    response->printf("ecg_queue_capacity{queue=\"record_blocks\"} %u\n", (unsigned)RECORD_RING_SIZE);
+    response->printf("ecg_queue_capacity{queue=\"upload_blocks\"} %u\n", (unsigned)UPLOAD_RING_SIZE);
+    
+    response->print("# HELP ecg_boot_first_block_ms Time from boot to the first processed sample block\n");
+    response->print("# TYPE ecg_boot_first_block_ms gauge\n");
+    response->printf("ecg_boot_first_block_ms %u\n", (unsigned)firstBlockMillis.load());
+    
+    response->print("# HELP ecg_heap_free_bytes Free internal heap\n");
+    response->print("# TYPE ecg_heap_free_bytes gauge\n");
+    response->printf("ecg_heap_free_bytes %u\n", (unsigned)heap_caps_get_free_size(MALLOC_CAP_8BIT));
+    response->print("# HELP ecg_heap_min_free_bytes Lowest free heap since boot\n");
+    response->print("# TYPE ecg_heap_min_free_bytes gauge\n");
+    response->printf("ecg_heap_min_free_bytes %u\n", (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+    response->print("# HELP ecg_heap_largest_free_block_bytes Largest allocation that can currently succeed\n");
+    response->print("# TYPE ecg_heap_largest_free_block_bytes gauge\n");
+    response->printf("ecg_heap_largest_free_block_bytes %u\n",
+                     (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    
+    response->print("# HELP ecg_ws_clients Connected WebSocket clients\n");
+    response->print("# TYPE ecg_ws_clients gauge\n");
+    response->printf("ecg_ws_clients %u\n", (unsigned)ws.count());
+    response->print("# HELP ecg_ws_frames_total Stream frames not sent at full rate\n");
+    response->print("# TYPE ecg_ws_frames_total counter\n");
+    response->printf("ecg_ws_frames_total{result=\"decimated\"} %u\n", (unsigned)wsFramesDecimated);
+    response->printf("ecg_ws_frames_total{result=\"skipped\"} %u\n", (unsigned)wsFramesSkipped);
+    response->print("# HELP ecg_ws_slow_clients_dropped_total Clients disconnected for falling behind\n");
+    response->print("# TYPE ecg_ws_slow_clients_dropped_total counter\n");
+    response->printf("ecg_ws_slow_clients_dropped_total %u\n", (unsigned)wsSlowClientsDropped);
+    response->print("# HELP ecg_ws_messages_too_long_total Status messages dropped for not fitting WS_MESSAGE_SIZE\n");
+    response->print("# TYPE ecg_ws_messages_too_long_total counter\n");
+    response->printf("ecg_ws_messages_too_long_total %u\n", (unsigned)wsMessagesTooLong.load(std::memory_order_relaxed));
     
-    for (size_t i = 0; i < x1.size(); i++) {
-        float diff = x1[i] - x2[i];
-        squaredDistance += diff * diff;
+    response->print("# HELP ecg_leads_off Whether a channel's electrodes are detached\n");
+    response->print("# TYPE ecg_leads_off gauge\n");
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        response->printf("ecg_leads_off{channel=\"%d\"} %d\n", c, leadsOff(c) ? 1 : 0);
     }
+    response->print("# HELP ecg_sampling_paused Whether the ADC is stopped because every lead is off\n");
+    response->print("# TYPE ecg_sampling_paused gauge\n");
+    response->printf("ecg_sampling_paused %d\n", samplingPaused ? 1 : 0);
     
-    return exp(-gamma * squaredDistance);
+    response->print("# HELP ecg_uptime_seconds Time since boot\n");
+    response->print("# TYPE ecg_uptime_seconds gauge\n");
+    response->printf("ecg_uptime_seconds %lu\n", (unsigned long)(millis() / 1000));
+    request->send(response);
 }
 
-void standardizeFeatures(std::vector<float>& features) {
-    // Apply same standardization as used during training
-    for (size_t i = 0; i < features.size(); i++) {
-        features[i] = (features[i] - svmModel.featureMeans[i]) / svmModel.featureStds[i];
+void printHistogram(Print& out, const char* name, const char* label, const CycleHistogram& histogram) {
+    // Prometheus buckets are cumulative; count is derived from them so it
+    // always matches the +Inf bucket
+    uint32_t cumulative = 0;
+    for (int i = 0; i < CYCLE_HISTOGRAM_BUCKETS; i++) {
+        cumulative += histogram.bucketCount(i);
+        if (i < CYCLE_HISTOGRAM_BUCKETS - 1) {
+            out.printf("%s_bucket{stage=\"%s\",le=\"%u\"} %u\n", name, label, (unsigned)CycleHistogram::bucketBound(i), (unsigned)cumulative);
+        } else {
+            out.printf("%s_bucket{stage=\"%s\",le=\"+Inf\"} %u\n", name, label, (unsigned)cumulative);
+        }
+    }
+    out.printf("%s_sum{stage=\"%s\"} %llu\n", name, label, (unsigned long long)histogram.sum());
+    out.printf("%s_count{stage=\"%s\"} %u\n", name, label, (unsigned)cumulative);
+}
+
+uint32_t modelIdOf(const AnomalyModel* model) {
+#if SVM_ENGINE == SVM_ENGINE_FLOAT
+    for (int slot = 0; slot < MODEL_SLOT_COUNT; slot++) {
+        if (model == &modelSlots[slot].model) {
+            return modelSlots[slot].modelId;
+        }
+    }
+#endif
+    // The compiled-in model is known by its bias and engine, so a reflashed
+    // model does not inherit thresholds computed for the previous one
+    return crc32Update(SVM_ENGINE, (const uint8_t*)&builtinModel.bias, sizeof(builtinModel.bias));
+}
+
+void loadCalibrations() {
+    uint32_t modelId = modelIdOf(activeModel.load());
+    calibrationStore.begin(CALIBRATION_NAMESPACE, false);
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        calibrationCommands[c].store(CALIBRATION_NONE);
+        calibrationSavePending[c].store(false);
+        
+        PatientCalibration& calibration = calibrations[c];
+        char key[8];
+        snprintf(key, sizeof(key), "ch%d", c);
+        if (calibrationStore.getBytes(key, &calibration, sizeof(calibration)) != sizeof(calibration) ||
+            calibration.version != CALIBRATION_VERSION) {
+            calibration = {};
+            calibration.version = CALIBRATION_VERSION;
+        } else {
+            if (calibration.modelId != modelId) {
+                calibration.threshold = 0.0f;  // The patient's means still apply, the offsets follow the model
+            }
+            Serial.printf("Channel %d calibrated from %u beats, threshold %.4f\n", c,
+                          (unsigned)calibration.beats, calibration.threshold);
+        }
+        calibration.modelId = modelId;
+        updateCalibrationOffsets(c, activeModel.load());
+    }
+}
+
+void updateCalibrationOffsets(int channel, const AnomalyModel* model) {
+    const PatientCalibration& calibration = calibrations[channel];
+    for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+        calibrationOffsets[channel][i] = calibration.beats == 0 ? 0.0f :
+            CALIBRATION_FEATURE_WEIGHT * (calibration.featureMeans[i] - model->featureMeans[i]);
+    }
+}
+
+void serviceCalibrations() {
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        uint8_t command = calibrationCommands[c].exchange(CALIBRATION_NONE);
+        if (command == CALIBRATION_START) {
+            calibrationSessions[c] = {};
+            calibrationSessions[c].active = true;
+            broadcastWsMessage("{\"type\":\"calibration\",\"channel\":%d,\"status\":\"started\",\"beats\":%d}",
+                               c, CALIBRATION_BEATS);
+        } else if (command == CALIBRATION_CLEAR) {
+            calibrationSessions[c].active = false;
+            uint32_t modelId = calibrations[c].modelId;
+            calibrations[c] = {};
+            calibrations[c].version = CALIBRATION_VERSION;
+            calibrations[c].modelId = modelId;
+            updateCalibrationOffsets(c, processingModel);
+            calibrationDirty[c] = true;
+            broadcastWsMessage("{\"type\":\"calibration\",\"channel\":%d,\"status\":\"cleared\"}", c);
+        }
+        
+        // Hand finished calibrations to the recorder task once it is done with the last one
+        if (calibrationDirty[c] && !calibrationSavePending[c].load(std::memory_order_acquire)) {
+            calibrationSaveBuffers[c] = calibrations[c];
+            calibrationSavePending[c].store(true, std::memory_order_release);
+            calibrationDirty[c] = false;
+            xTaskNotifyGive(recorderTaskHandle);
+        }
+    }
+}
+
+void calibrateBeat(int channel, const float* segment) {
+    CalibrationSession& session = calibrationSessions[channel];
+    const int featureBeats = CALIBRATION_BEATS / 2;
+    session.beats++;
+    
+    if (session.beats <= featureBeats) {
+        // Streaming mean of every feature
+        for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+            session.featureMeans[i] += (segment[i] - session.featureMeans[i]) / session.beats;
+        }
+        return;
+    }
+    
+    // Full decision, without the cascade, on the window with the new offsets
+    const float* trainingMeans = processingModel->featureMeans;
+    for (int i = 0; i < ECG_BUFFER_SIZE; i++) {
+        float offset = CALIBRATION_FEATURE_WEIGHT * (session.featureMeans[i] - trainingMeans[i]);
+        calibrationWindow[i] = processingModel->standardize(segment[i] - offset, i);
+    }
+    session.decisions.add((double)processingModel->decision(calibrationWindow) / processingModel->decisionScale());
+    
+    if (session.beats == CALIBRATION_BEATS) {
+        finishCalibration(channel);
+    }
+}
+
+void finishCalibration(int channel) {
+    CalibrationSession& session = calibrationSessions[channel];
+    session.active = false;
+    float anomalousShare = session.decisions.anomalousShare();
+    if (!session.decisions.accepted()) {
+        Serial.printf("Calibration of channel %d rejected: %.0f%% of beats anomalous\n", channel, anomalousShare * 100);
+        broadcastWsMessage("{\"type\":\"calibration\",\"channel\":%d,\"status\":\"rejected\",\"anomalous\":%.3f}",
+                           channel, anomalousShare);
+        return;
+    }
+    
+    PatientCalibration& calibration = calibrations[channel];
+    memcpy(calibration.featureMeans, session.featureMeans, sizeof(calibration.featureMeans));
+    calibration.threshold = session.decisions.threshold() * processingModel->decisionScale();
+    calibration.beats = CALIBRATION_BEATS;
+    calibration.modelId = modelIdOf(processingModel);
+    updateCalibrationOffsets(channel, processingModel);
+    calibrationDirty[channel] = true;
+    
+    Serial.printf("Channel %d calibrated: threshold %.4f, %.0f%% of beats were anomalous before\n", channel,
+                  calibration.threshold, anomalousShare * 100);
+    broadcastWsMessage("{\"type\":\"calibration\",\"channel\":%d,\"status\":\"done\",\"threshold\":%.4f,"
+                       "\"anomalous\":%.3f}", channel, calibration.threshold, anomalousShare);
+}
+
+void saveCalibrations() {
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        if (!calibrationSavePending[c].load(std::memory_order_acquire)) {
+            continue;
+        }
+        char key[8];
+        snprintf(key, sizeof(key), "ch%d", c);
+        if (calibrationStore.putBytes(key, &calibrationSaveBuffers[c], sizeof(PatientCalibration)) !=
+            sizeof(PatientCalibration)) {
+            Serial.printf("Failed to save the calibration of channel %d\n", c);
+        }
+        calibrationSavePending[c].store(false, std::memory_order_release);
+    }
+}
+
+void handleCalibrationInfo(AsyncWebServerRequest *request) {
+    AsyncResponseStream* response = request->beginResponseStream("application/json");
+    response->print("{\"channels\":[");
+    for (int c = 0; c < ECG_CHANNEL_COUNT; c++) {
+        const CalibrationSession& session = calibrationSessions[c];
+        response->printf("%s{\"channel\":%d,\"beats\":%u,\"threshold\":%.4f,\"calibrating\":%s,\"progress\":%d}",
+                         c ? "," : "", c, (unsigned)calibrations[c].beats, calibrations[c].threshold,
+                         session.active ? "true" : "false", session.active ? session.beats : 0);
+    }
+    response->printf("],\"requiredBeats\":%d}", CALIBRATION_BEATS);
+    request->send(response);
+}
+
+void handleCalibrationCommand(AsyncWebServerRequest *request) {
+#if ANOMALY_TRIGGER == ANOMALY_TRIGGER_BEAT
+    if (!request->hasParam("channel") || !request->hasParam("action")) {
+        request->send(400, "application/json", "{\"error\":\"channel and action parameters required\"}");
+        return;
+    }
+    size_t channel;
+    String action = request->getParam("action")->value();
+    if (!parseDecimal(request->getParam("channel")->value(), channel)) {
+        request->send(400, "application/json", "{\"error\":\"channel must be a number\"}");
+        return;
     }
+    if (channel >= ECG_CHANNEL_COUNT) {
+        request->send(404, "application/json", "{\"error\":\"no such channel\"}");
+        return;
+    }
+    if (action == "start") {
+        calibrationCommands[channel].store(CALIBRATION_START);
+    } else if (action == "clear") {
+        calibrationCommands[channel].store(CALIBRATION_CLEAR);
+    } else {
+        request->send(400, "application/json", "{\"error\":\"action must be start or clear\"}");
+        return;
+    }
+    request->send(202, "application/json", "{\"status\":\"accepted\"}");
+#else
+    request->send(409, "application/json", "{\"error\":\"calibration needs the beat trigger\"}");
+#endif
+}
+
+float calculateCalories(float heartRate, unsigned long elapsedMinutes) {
+    // Simple calorie calculation - replace with a more accurate formula if needed
+    // This is a rough estimate using heart rate
+    
+    // Example formula: calories = average_heart_rate * minutes * factor
+    // where factor depends on gender, age, weight, etc.
+    float factor = 0.1; // Example factor, adjust based on individual
+    
+    return heartRate * elapsedMinutes * factor;
+}
+
+void detectAnomalies(const float* const* windows, int count, bool* anomalous, const float* thresholds) {
+    // Use SVM model to detect anomalies, one batched pass for all windows
+    // windows must already be standardized (same as in training), thresholds
+    // are the per-window calibrated boundaries
+    processingModel->isAnomalousBatch(windows, count, anomalous, thresholds);
 }
@@ -1,10 +1,39 @@
 # SVM Model Extraction for ESP32
 # This script extracts parameters from the trained SVM model and formats them for ESP32 deployment
 
+import argparse
 import numpy as np
 import pandas as pd
 import joblib
 import json
+import struct
+import sys
+import time
+import zlib
+
+parser = argparse.ArgumentParser(description="Extract SVM parameters for ESP32 deployment")
+parser.add_argument("--quantize", choices=["none", "int8", "int16"], default="none",
+                    help="also emit svm_model_quantized.h for the fixed-point inference engine")
+parser.add_argument("--calibration-data", metavar="CSV",
+                    help="ECG CSV (140 samples + label per row) used to calibrate quantization "
+                         "ranges and check agreement with the float model")
+parser.add_argument("--sv-budget", type=int, metavar="N",
+                    help="compress the model to at most N support vectors (pruning with a least-squares "
+                         "refit of the remaining coefficients); the result is a drop-in replacement")
+parser.add_argument("--validation-data", metavar="CSV",
+                    help="labelled ECG CSV (e.g. the held-out split from train.ipynb) used to report "
+                         "the accuracy of the emitted model against the trained one")
+parser.add_argument("--rff", type=int, metavar="D",
+                    help="also emit svm_model_rff.h: a linear model over D random Fourier features "
+                         "for the SVM_ENGINE_RFF inference engine")
+parser.add_argument("--rff-seed", type=int, default=0,
+                    help="random seed for the Fourier projection (default 0)")
+parser.add_argument("--binary", metavar="FILE",
+                    help="also write the float model as a binary model file that the firmware "
+                         "can load at runtime (POST /model)")
+parser.add_argument("--model-id", type=int, default=None,
+                    help="identifier stored in the binary model file (default: current Unix time)")
+args = parser.parse_args()
 
 # Load the trained SVM model
 print("Loading SVM model...")
@@ -34,10 +63,196 @@ bias = svm_model.intercept_[0]
 # Gamma parameter for RBF kernel
 gamma = svm_model._gamma
 
+def rbf_kernel(a, b):
+    """K[i, j] = exp(-gamma * ||a_i - b_j||^2)"""
+    sq_dist = np.sum(a ** 2, axis=1)[:, None] + np.sum(b ** 2, axis=1)[None, :] - 2 * a @ b.T
+    return np.exp(-gamma * np.maximum(sq_dist, 0))
+
+def float_decision(standardized):
+    """Decision values of the model being emitted, as the float engine computes them on device."""
+    return rbf_kernel(standardized, support_vectors) @ dual_coefs + bias
+
+def load_labelled(path):
+    """Standardized windows and labels from an ECG CSV (140 samples + label per row)."""
+    df = pd.read_csv(path)
+    return scaler.transform(df.iloc[:, :-1].values), df.iloc[:, -1].values
+
+# Reduced-set compilation (--sv-budget)
+# Inference cost on device is linear in the number of support vectors. The
+# model is pruned in rounds of at most 10%: the vectors whose kernel columns
+# contribute least to the decision function are dropped, then the remaining
+# coefficients and the bias are refit by least squares so the decision values
+# match the original model on the fit points (the original support vectors,
+# plus the calibration beats when given). The RBF kernel and gamma are
+# unchanged, so the firmware runs the result as is.
+if args.sv_budget is not None and args.sv_budget < num_support_vectors:
+    if args.sv_budget < 1:
+        parser.error("--sv-budget must be at least 1")
+    print(f"Reducing support vectors: {num_support_vectors} -> {args.sv_budget}...")
+    original_support_vectors = support_vectors
+    fit_points = support_vectors
+    if args.calibration_data:
+        fit_points = np.vstack([fit_points, load_labelled(args.calibration_data)[0]])
+    fit_kernel = rbf_kernel(fit_points, original_support_vectors)
+    target = fit_kernel @ dual_coefs + bias
+
+    keep = np.arange(num_support_vectors)
+    coefs = dual_coefs
+    while len(keep) > args.sv_budget:
+        contribution = np.abs(coefs) * np.linalg.norm(fit_kernel[:, keep], axis=0)
+        drop = min(len(keep) - args.sv_budget, max(1, len(keep) // 10))
+        keep = np.sort(keep[np.argsort(contribution)[drop:]])
+
+        design = np.hstack([fit_kernel[:, keep], np.ones((len(fit_points), 1))])
+        solution = np.linalg.lstsq(design, target, rcond=None)[0]
+        coefs, bias = solution[:-1], solution[-1]
+
+    support_vectors = original_support_vectors[keep]
+    dual_coefs = coefs
+    num_support_vectors = len(keep)
+    fit_error = np.sqrt(np.mean((float_decision(fit_points) - target) ** 2))
+    print(f"Reduced model: {num_support_vectors} support vectors, decision RMS error {fit_error:.4f} "
+          f"on {len(fit_points)} fit points (decision std {np.std(target):.4f})")
+
+# Accuracy of the emitted model next to the trained one
+if args.validation_data:
+    validation, labels = load_labelled(args.validation_data)
+    def predict(decision):
+        # Binary SVC: positive decisions are classes_[1]
+        return np.where(decision > 0, svm_model.classes_[1], svm_model.classes_[0])
+    trained_decision = svm_model.decision_function(validation)
+    emitted_decision = float_decision(validation)
+    trained_accuracy = np.mean(predict(trained_decision) == labels)
+    emitted_accuracy = np.mean(predict(emitted_decision) == labels)
+    agreement = np.mean((trained_decision > 0) == (emitted_decision > 0))
+    print(f"Validation ({len(labels)} beats): trained model {trained_accuracy:.4%} with "
+          f"{svm_model.support_vectors_.shape[0]} support vectors, emitted model {emitted_accuracy:.4%} "
+          f"with {num_support_vectors} ({(emitted_accuracy - trained_accuracy) * 100:+.2f} points), "
+          f"{agreement:.4%} of decisions agree")
+    for label in svm_model.classes_:
+        mask = labels == label
+        if mask.any():
+            print(f"  class {label}: recall {np.mean(predict(trained_decision[mask]) == label):.4%} -> "
+                  f"{np.mean(predict(emitted_decision[mask]) == label):.4%}")
+
+# Cascade evaluation
+# Kernel values lie in (0, 1], so once support vectors 0..i-1 are summed the
+# rest of the decision is bounded by the sums of the remaining positive and
+# negative coefficients. Storing the support vectors by decreasing |alpha|
+# makes those bounds shrink fastest, and the firmware stops as soon as the
+# sign of the decision is settled. The order does not change any decision.
+order = np.argsort(-np.abs(dual_coefs), kind="stable")
+support_vectors = support_vectors[order]
+dual_coefs = dual_coefs[order]
+remaining_positive = np.append(np.cumsum(np.maximum(dual_coefs, 0)[::-1])[::-1], 0.0)
+remaining_negative = np.append(np.cumsum(np.minimum(dual_coefs, 0)[::-1])[::-1], 0.0)
+
+# Linear pre-filter
+# A least-squares linear fit h(x) = w.x + c of the decision function over the
+# support vectors and the calibration beats. Windows with h(x) above every
+# value seen on a fit point the SVM calls anomalous are cleared as normal
+# without evaluating a single kernel. The threshold comes from real beats, so
+# the pre-filter is only emitted with --calibration-data.
+prefilter_enabled = False
+prefilter_weights = np.zeros(num_features)
+prefilter_bias = 0.0
+prefilter_threshold = 0.0
+if args.calibration_data:
+    fit_points = np.vstack([support_vectors, load_labelled(args.calibration_data)[0]])
+    fit_decision = float_decision(fit_points)
+    design = np.hstack([fit_points, np.ones((len(fit_points), 1))])
+    solution = np.linalg.lstsq(design, fit_decision, rcond=None)[0]
+    prefilter_weights, prefilter_bias = solution[:-1], solution[-1]
+    scores = fit_points @ prefilter_weights + prefilter_bias
+    if (fit_decision < 0).any():
+        # Margin for anomalies slightly beyond the ones seen here
+        prefilter_threshold = np.max(scores[fit_decision < 0]) + 0.1 * np.std(scores)
+        prefilter_enabled = True
+        print(f"Linear pre-filter clears {np.mean(scores > prefilter_threshold):.2%} of "
+              f"{len(fit_points)} fit points")
+        if args.validation_data:
+            validation_scores = validation @ prefilter_weights + prefilter_bias
+            cleared = validation_scores > prefilter_threshold
+            missed = np.sum(cleared & (float_decision(validation) < 0))
+            print(f"  validation: {np.mean(cleared):.2%} cleared, {missed} beats the SVM calls anomalous "
+                  f"would be cleared")
+    else:
+        print("Linear pre-filter skipped: no fit point is anomalous")
+
+# Squared norms of the support vectors, used by the dot-product form of the
+# RBF kernel on device: ||x - sv||^2 = ||x||^2 + ||sv||^2 - 2 x.sv
+support_vector_sq_norms = np.sum(support_vectors ** 2, axis=1)
+
 # Get feature means and standard deviations from the scaler
 feature_means = scaler.mean_
 feature_stds = scaler.scale_
 
+# The firmware applies this scaler to beats in volts and nothing else. Rows
+# z-normalized one by one (as in ECG5000) average to mean 0 and unit
+# variance, which shows in the scaler: such a model needs retraining on beats
+# recorded by the device (or on de-normalized ones).
+row_mean = np.mean(feature_means)
+row_variance = np.mean(feature_stds ** 2 + feature_means ** 2) - row_mean ** 2
+if abs(row_mean) < 1e-3 and abs(row_variance - 1.0) < 1e-2:
+    print("WARNING: the scaler was fitted on z-normalized beats, but the firmware classifies beats in volts")
+
+# Folded standardization
+# The header carries 1 / std, so the firmware standardizes with a subtraction
+# and a multiply per feature instead of a division. The device path - float32
+# (x - mean) * (1 / std), then the kernel expansion - is checked against the
+# sklearn pipeline on raw beats: the calibration or validation beats when
+# given, otherwise the support vectors mapped back to raw voltages. A reduced
+# model (--sv-budget) is checked against its own float64 decision instead.
+# Every table, gamma and the bias are read back from the literals printed into
+# the header, and the kernel is evaluated both ways the engine does it: the
+# direct (x - sv)^2 loop and, for esp-dsp, the expansion with the emitted
+# norms. The script fails when either drifts from the reference.
+TABLE_FORMAT = "{:.6f}f"
+SCALAR_FORMAT = "{}f"
+FEATURE_MEAN_FORMAT = "{:.9e}f"
+FEATURE_INVERSE_STD_FORMAT = "{:.9e}f"
+feature_inverse_stds = (1.0 / feature_stds).astype(np.float32)
+
+def emitted_values(values, fmt):
+    """Values as the firmware reads them back from the generated header."""
+    return np.array([float(fmt.format(v)[:-1]) for v in values], dtype=np.float32)
+
+def emitted_decisions(standardized):
+    """Decision values from the emitted literals, with the direct and the expanded kernel."""
+    emitted_support_vectors = emitted_values(support_vectors.flatten(), TABLE_FORMAT).reshape(
+        support_vectors.shape).astype(np.float64)
+    emitted_coefs = emitted_values(dual_coefs, TABLE_FORMAT).astype(np.float64)
+    emitted_sq_norms = emitted_values(support_vector_sq_norms, TABLE_FORMAT).astype(np.float64)
+    emitted_gamma = float(emitted_values([gamma], SCALAR_FORMAT)[0])
+    emitted_bias = float(emitted_values([bias], SCALAR_FORMAT)[0])
+    # In float64 the direct distance is the expansion with the exact norms of the emitted vectors
+    cross = np.sum(standardized ** 2, axis=1)[:, None] - 2 * standardized @ emitted_support_vectors.T
+    direct = np.maximum(cross + np.sum(emitted_support_vectors ** 2, axis=1)[None, :], 0)
+    expanded = np.maximum(cross + emitted_sq_norms[None, :], 0)
+    return [np.exp(-emitted_gamma * distance) @ emitted_coefs + emitted_bias for distance in (direct, expanded)]
+
+if args.validation_data or args.calibration_data:
+    raw_beats = pd.read_csv(args.validation_data or args.calibration_data).iloc[:, :-1].values
+else:
+    raw_beats = support_vectors * feature_stds + feature_means
+device_standardized = ((raw_beats.astype(np.float32) - emitted_values(feature_means, FEATURE_MEAN_FORMAT))
+                       * emitted_values(feature_inverse_stds, FEATURE_INVERSE_STD_FORMAT)).astype(np.float64)
+if args.sv_budget is not None and num_support_vectors < svm_model.support_vectors_.shape[0]:
+    reference_decision = float_decision(scaler.transform(raw_beats))
+else:
+    reference_decision = svm_model.decision_function(scaler.transform(raw_beats))
+folding_tolerance = 1e-3 * max(np.std(reference_decision), 1e-6)
+folding_failed = False
+for form, device_decision in zip(("direct", "expanded"), emitted_decisions(device_standardized)):
+    folding_error = np.max(np.abs(device_decision - reference_decision))
+    folding_agreement = np.mean((device_decision > 0) == (reference_decision > 0))
+    print(f"Emitted model, {form} kernel, on {len(raw_beats)} beats: max decision error "
+          f"{folding_error:.2e} (tolerance {folding_tolerance:.2e}), {folding_agreement:.4%} of decisions agree")
+    folding_failed = folding_failed or folding_error > folding_tolerance
+if folding_failed:
+    sys.exit("ERROR: the emitted header differs from the trained pipeline, check the scaler and the "
+             "precision of the emitted tables")
+
 # Create a dictionary to store all parameters
 svm_params = {
     "num_support_vectors": num_support_vectors,
@@ -46,8 +261,17 @@ svm_params = {
     "bias": bias,
     "dual_coefficients": dual_coefs.tolist(),
     "support_vectors": support_vectors.flatten().tolist(),
+    "support_vector_sq_norms": support_vector_sq_norms.tolist(),
     "feature_means": feature_means.tolist(),
-    "feature_stds": feature_stds.tolist()
+    "feature_stds": feature_stds.tolist(),
+    "feature_inverse_stds": feature_inverse_stds.tolist(),
+    "remaining_positive": remaining_positive.tolist(),
+    "remaining_negative": remaining_negative.tolist(),
+    "prefilter": {
+        "weights": prefilter_weights.tolist(),
+        "bias": prefilter_bias,
+        "threshold": prefilter_threshold
+    } if prefilter_enabled else None
 }
 
 # Save parameters as JSON
@@ -59,74 +283,296 @@ print("SVM parameters saved to svm_params.json")
 # Generate C++ code with model parameters
 print("Generating C++ code...")
 
-cpp_code = f"""
-// SVM Model Parameters
+def c_array(ctype, name, size, values, fmt=TABLE_FORMAT):
+    """Format values as a 16-byte aligned, flash-resident C array, 8 values per line."""
+    code = f"alignas(16) const {ctype} {name}[{size}] = {{\n"
+    for i in range(0, len(values), 8):
+        code += "    " + ", ".join(fmt.format(v) for v in values[i:i + 8])
+        code += ",\n" if i + 8 < len(values) else "\n"
+    code += "};\n"
+    return code
+
+cpp_code = f"""// SVM Model Parameters
 // Auto-generated by SVM extraction script
+// Input domain: the firmware classifies 140-sample beats in volts taken after
+// its filter cascade (0.5-40Hz band-pass and mains notch, zero-centred), and
+// standardizes them with the means below. The scaler must have been fitted on
+// beats in that domain, e.g. recorded by the device, not on raw ADC traces.
+#pragma once
 
 // Model configuration
-const int SVM_NUM_SUPPORT_VECTORS = {num_support_vectors};
-const int SVM_NUM_FEATURES = {num_features};
-const float SVM_GAMMA = {gamma}f;
-const float SVM_BIAS = {bias}f;
+constexpr int SVM_NUM_SUPPORT_VECTORS = {num_support_vectors};
+constexpr int SVM_NUM_FEATURES = {num_features};
+constexpr float SVM_GAMMA = {SCALAR_FORMAT.format(gamma)};
+constexpr float SVM_BIAS = {SCALAR_FORMAT.format(bias)};
+constexpr bool SVM_PREFILTER = {"true" if prefilter_enabled else "false"};  // svmPrefilterWeights is fitted
+constexpr float SVM_PREFILTER_BIAS = {prefilter_bias:.9e}f;
+constexpr float SVM_PREFILTER_THRESHOLD = {prefilter_threshold:.9e}f;
 
-// Feature normalization parameters (means and standard deviations)
-const float featureMeans[SVM_NUM_FEATURES] = {{
+// Feature normalization parameters (means and inverse standard deviations)
 """
 
-# Add feature means
-for i in range(0, num_features, 8):  # 8 values per line
-    cpp_code += "    "
-    for j in range(i, min(i + 8, num_features)):
-        cpp_code += f"{feature_means[j]:.6f}f"
-        if j < num_features - 1:
-            cpp_code += ", "
-    cpp_code += "\n"
-
-cpp_code += "};\n\nconst float featureStds[SVM_NUM_FEATURES] = {\n"
-
-# Add feature standard deviations
-for i in range(0, num_features, 8):  # 8 values per line
-    cpp_code += "    "
-    for j in range(i, min(i + 8, num_features)):
-        cpp_code += f"{feature_stds[j]:.6f}f"
-        if j < num_features - 1:
-            cpp_code += ", "
-    cpp_code += "\n"
-
-cpp_code += "};\n\n// Support vector coefficients (alpha_i * y_i)\n"
-cpp_code += "const float svmCoefficients[SVM_NUM_SUPPORT_VECTORS] = {\n"
-
-# Add dual coefficients
-for i in range(0, num_support_vectors, 8):  # 8 values per line
-    cpp_code += "    "
-    for j in range(i, min(i + 8, num_support_vectors)):
-        cpp_code += f"{dual_coefs[j]:.6f}f"
-        if j < num_support_vectors - 1:
-            cpp_code += ", "
-    cpp_code += "\n"
-
-cpp_code += "};\n\n// Support vectors (flattened)\n"
-cpp_code += "const float supportVectors[SVM_NUM_SUPPORT_VECTORS * SVM_NUM_FEATURES] = {\n"
-
-# Add support vectors
-flat_sv = support_vectors.flatten()
-for i in range(0, len(flat_sv), 8):  # 8 values per line
-    cpp_code += "    "
-    for j in range(i, min(i + 8, len(flat_sv))):
-        cpp_code += f"{flat_sv[j]:.6f}f"
-        if j < len(flat_sv) - 1:
-            cpp_code += ", "
-    cpp_code += "\n"
-
-cpp_code += "};\n"
+cpp_code += c_array("float", "featureMeans", "SVM_NUM_FEATURES", feature_means, FEATURE_MEAN_FORMAT)
+cpp_code += "\n"
+cpp_code += c_array("float", "featureInverseStds", "SVM_NUM_FEATURES", feature_inverse_stds,
+                    FEATURE_INVERSE_STD_FORMAT)
+cpp_code += "\n// Support vector coefficients (alpha_i * y_i)\n"
+cpp_code += c_array("float", "svmCoefficients", "SVM_NUM_SUPPORT_VECTORS", dual_coefs)
+cpp_code += "\n// Support vectors (flattened)\n"
+cpp_code += c_array("float", "supportVectors", "SVM_NUM_SUPPORT_VECTORS * SVM_NUM_FEATURES",
+                    support_vectors.flatten())
+cpp_code += "\n// Squared norm of each support vector\n"
+cpp_code += c_array("float", "supportVectorSqNorms", "SVM_NUM_SUPPORT_VECTORS", support_vector_sq_norms)
+cpp_code += "\n// Cascade bounds: sums of the positive / negative coefficients from support vector i on\n"
+cpp_code += c_array("float", "svmRemainingPositive", "SVM_NUM_SUPPORT_VECTORS + 1", remaining_positive)
+cpp_code += "\n"
+cpp_code += c_array("float", "svmRemainingNegative", "SVM_NUM_SUPPORT_VECTORS + 1", remaining_negative)
+cpp_code += "\n// Linear pre-filter: windows scoring above SVM_PREFILTER_THRESHOLD are normal\n"
+cpp_code += c_array("float", "svmPrefilterWeights", "SVM_NUM_FEATURES", prefilter_weights, "{:.9e}f")
 
 # Write C++ code to file
 with open('svm_model_params.h', 'w') as f:
     f.write(cpp_code)
 
 print("C++ header file with model parameters saved to svm_model_params.h")
+
+# Binary model file for runtime loading (lib/ecg_core/model_format.h)
+# A 64-byte header, then float32 sections each aligned to 16 bytes so the
+# firmware can use them in place from memory-mapped flash
+MODEL_FILE_MAGIC = 0x424D5653  # "SVMB"
+MODEL_FILE_VERSION = 2
+MODEL_HEADER_SIZE = 64
+MODEL_ALIGNMENT = 16
+
+def write_model_file(path, model_id):
+    sections = [
+        support_vectors.flatten(),
+        dual_coefs,
+        support_vector_sq_norms,
+        feature_means,
+        feature_stds,
+    ]
+    if prefilter_enabled:
+        # bias, threshold, two pad words, then the weights
+        sections.append(np.concatenate([[prefilter_bias, prefilter_threshold, 0.0, 0.0], prefilter_weights]))
+    payload = b""
+    offsets = []
+    for values in sections:
+        padding = -(MODEL_HEADER_SIZE + len(payload)) % MODEL_ALIGNMENT
+        payload += b"\0" * padding
+        offsets.append(MODEL_HEADER_SIZE + len(payload))
+        payload += np.asarray(values, dtype="<f4").tobytes()
+    total_size = MODEL_HEADER_SIZE + len(payload)
+
+    prefilter_offset = offsets[5] if prefilter_enabled else 0
+
+    # magic, version, headerSize, N, F, gamma, bias, 5 offsets, totalSize, modelId
+    header = struct.pack("<IHHIIff5III", MODEL_FILE_MAGIC, MODEL_FILE_VERSION, MODEL_HEADER_SIZE,
+                         num_support_vectors, num_features, gamma, bias, *offsets[:5], total_size, model_id)
+    # Then crc32, prefilterOffset and a reserved word; the CRC skips its own field
+    tail = struct.pack("<I4x", prefilter_offset)
+    crc = zlib.crc32(payload, zlib.crc32(tail, zlib.crc32(header)))
+    header += struct.pack("<I", crc) + tail
+    assert len(header) == MODEL_HEADER_SIZE
+
+    with open(path, "wb") as f:
+        f.write(header + payload)
+    print(f"Binary model saved to {path}: {total_size} bytes, id {model_id}, crc32 {crc:08x}")
+
+if args.binary:
+    write_model_file(args.binary, args.model_id if args.model_id is not None else int(time.time()))
+
+# Fixed-point model for the quantized engine (SVM_ENGINE_QUANTIZED)
+# Everything lives in standardized feature space, like the float model:
+#   - support vectors use a per-feature scale s_f: sv ~= q_sv * s_f
+#   - the squared distance sum_f s_f^2 (q_x - q_sv)^2 is accumulated in integers
+#     with per-feature weights s_f^2 / max(s^2) in Q15
+#   - exp(-t) comes from a Q15 lookup table, coefficients are Q15 of max |alpha|
+# quantized_decision() below mirrors the firmware arithmetic exactly.
+EXP_LUT_RESOLUTION = 16  # Table entries per unit of gamma * distance
+EXP_LUT_SIZE = 256       # Covers exp(-t) for t in [0, 16)
+
+if args.quantize != "none":
+    print(f"Quantizing model to {args.quantize}...")
+    q_max = 127 if args.quantize == "int8" else 32767
+    q_ctype = "int8_t" if args.quantize == "int8" else "int16_t"
+    # int8 products are shifted down so 140 of them fit a 32-bit accumulator;
+    # int16 uses a 64-bit accumulator instead
+    product_shift = 8 if args.quantize == "int8" else 0
+
+    # Per-feature range: every support vector and, when calibration data is
+    # given, 99.9% of real inputs (outliers beyond that are clipped)
+    calibration = None
+    feature_range = np.max(np.abs(support_vectors), axis=0)
+    if args.calibration_data:
+        calibration_df = pd.read_csv(args.calibration_data)
+        calibration = scaler.transform(calibration_df.iloc[:, :-1].values)
+        feature_range = np.maximum(feature_range, np.percentile(np.abs(calibration), 99.9, axis=0))
+    feature_scales = np.maximum(feature_range, 1e-6) / q_max
+
+    q_support_vectors = np.clip(np.round(support_vectors / feature_scales), -q_max, q_max).astype(np.int64)
+
+    weight_base = np.max(feature_scales ** 2)
+    q_weights = np.round(feature_scales ** 2 / weight_base * 32767).astype(np.int64)
+    kernel_scale = gamma * weight_base / 32767 * (2 ** product_shift)
+
+    alpha_scale = np.max(np.abs(dual_coefs)) / 32767
+    q_coefs = np.round(dual_coefs / alpha_scale).astype(np.int64)
+    q_bias = int(round(bias / alpha_scale * 32767))
+
+    exp_lut = np.round(np.exp(-np.arange(EXP_LUT_SIZE + 1) / EXP_LUT_RESOLUTION) * 32767).astype(np.int64)
+
+    def quantized_decision(standardized):
+        # lroundf() on device rounds halves away from zero
+        scaled = (standardized * (1.0 / feature_scales)).astype(np.float32)
+        qx = np.clip(np.trunc(scaled + np.copysign(0.5, scaled)), -q_max, q_max).astype(np.int64)
+        decisions = np.empty(len(qx), dtype=np.int64)
+        for n, x in enumerate(qx):
+            diff = x[None, :] - q_support_vectors
+            acc = ((q_weights[None, :] * diff * diff) >> product_shift).sum(axis=1)
+            t = acc.astype(np.float32) * np.float32(kernel_scale)
+            pos = np.floor(t * (EXP_LUT_RESOLUTION * 256)).astype(np.int64)
+            idx = np.minimum(pos >> 8, EXP_LUT_SIZE)
+            frac = pos & 255
+            nxt = np.minimum(idx + 1, EXP_LUT_SIZE)
+            k = exp_lut[idx] + (((exp_lut[nxt] - exp_lut[idx]) * frac) >> 8)
+            k[idx >= EXP_LUT_SIZE] = 0
+            decisions[n] = int((q_coefs * k).sum()) + q_bias
+        return decisions
+
+    if calibration is not None:
+        float_anomaly = float_decision(calibration) < 0
+        quant_anomaly = quantized_decision(calibration) < 0
+        agreement = np.mean(float_anomaly == quant_anomaly)
+        print(f"Quantized/float agreement on {len(calibration)} calibration beats: {agreement:.4%}")
+
+    float_bytes = support_vectors.size * 4
+    quant_bytes = support_vectors.size * (1 if args.quantize == "int8" else 2)
+    print(f"Support vector storage: {float_bytes} -> {quant_bytes} bytes")
+
+    q_code = f"""// Quantized SVM Model Parameters ({args.quantize})
+// Auto-generated by SVM extraction script, use with SVM_ENGINE_QUANTIZED
+#pragma once
+#include <cstdint>
+#include "svm_model_params.h"
+
+static_assert(SVM_NUM_SUPPORT_VECTORS == {num_support_vectors} && SVM_NUM_FEATURES == {num_features},
+              "svm_model_quantized.h was generated from a different model");
+
+typedef {q_ctype} svm_quantized_t;
+constexpr int SVM_Q_MAX = {q_max};
+constexpr int SVM_Q_PRODUCT_SHIFT = {product_shift};       // Right shift applied to each weighted product
+constexpr float SVM_Q_KERNEL_SCALE = {kernel_scale:.9e}f;  // gamma * distance per accumulator unit
+constexpr int64_t SVM_Q_BIAS = {q_bias}LL;                  // Bias in decision accumulator units
+constexpr float SVM_Q_DECISION_UNIT = {32767 / alpha_scale:.9e}f;  // Accumulator units per float decision unit
+constexpr int SVM_EXP_LUT_RESOLUTION = {EXP_LUT_RESOLUTION};
+constexpr int SVM_EXP_LUT_SIZE = {EXP_LUT_SIZE};
+
+// Standardized input -> quantized input (1 / s_f)
+"""
+    q_code += c_array("float", "quantInputScales", "SVM_NUM_FEATURES", 1.0 / feature_scales, "{:.9e}f")
+    q_code += "\n// Per-feature distance weights (s_f^2 / max s^2, Q15)\n"
+    q_code += c_array("uint16_t", "quantFeatureWeights", "SVM_NUM_FEATURES", q_weights, "{:d}")
+    q_code += "\n// Dual coefficients (Q15 of the largest |alpha|)\n"
+    q_code += c_array("int16_t", "quantCoefficients", "SVM_NUM_SUPPORT_VECTORS", q_coefs, "{:d}")
+    q_code += "\n// exp(-t) in Q15 for t = i / SVM_EXP_LUT_RESOLUTION\n"
+    q_code += c_array("uint16_t", "svmExpLut", "SVM_EXP_LUT_SIZE + 1", exp_lut, "{:d}")
+    q_code += "\n// Quantized support vectors (flattened)\n"
+    q_code += c_array("svm_quantized_t", "quantSupportVectors", "SVM_NUM_SUPPORT_VECTORS * SVM_NUM_FEATURES",
+                      q_support_vectors.flatten(), "{:d}")
+
+    with open('svm_model_quantized.h', 'w') as f:
+        f.write(q_code)
+    print("Quantized model saved to svm_model_quantized.h")
+
+# Random Fourier feature model for the RFF engine (SVM_ENGINE_RFF)
+# With W ~ N(0, 2 gamma I) and b ~ U[0, 2pi), (2/D) cos(Wx + b).cos(Wy + b)
+# is an unbiased estimate of the RBF kernel, so the SVM decision becomes a
+# linear function of phi(x) = cos(Wx + b): w = (2/D) sum_i alpha_i phi(sv_i).
+# A correction to that expansion is then fit by ridge regression against the
+# float decision on the support vectors (and calibration beats). The ridge
+# shrinks the correction, not the weights, so with fewer fit points than
+# components the result stays close to the expansion instead of becoming an
+# interpolation of a few points. The firmware computes bias + w.phi(x).
+if args.rff:
+    num_components = args.rff
+    print(f"Fitting {num_components} random Fourier features...")
+    rng = np.random.default_rng(args.rff_seed)
+    rff_projection = rng.normal(0.0, np.sqrt(2 * gamma), size=(num_components, num_features))
+    rff_phases = rng.uniform(0.0, 2 * np.pi, size=num_components)
+
+    def rff_phi(standardized):
+        return np.cos(standardized @ rff_projection.T + rff_phases)
+
+    expansion_weights = (2.0 / num_components) * rff_phi(support_vectors).T @ dual_coefs
+
+    fit_points = support_vectors
+    if args.calibration_data:
+        fit_points = np.vstack([fit_points, load_labelled(args.calibration_data)[0]])
+    design = np.hstack([rff_phi(fit_points), np.ones((len(fit_points), 1))])
+    expansion_residual = float_decision(fit_points) - (rff_phi(fit_points) @ expansion_weights + bias)
+    ridge = 1e-3 * np.mean(np.sum(design ** 2, axis=0))
+    regularizer = ridge * np.eye(design.shape[1])
+    regularizer[-1, -1] = 0  # The bias correction is not shrunk
+    correction = np.linalg.solve(design.T @ design + regularizer, design.T @ expansion_residual)
+    rff_weights = expansion_weights + correction[:-1]
+    rff_bias = bias + correction[-1]
+
+    def rff_decision(standardized):
+        return rff_phi(standardized) @ rff_weights + rff_bias
+
+    fit_error = np.sqrt(np.mean((rff_decision(fit_points) - float_decision(fit_points)) ** 2))
+    expansion_error = np.sqrt(np.mean(expansion_residual ** 2))
+    print(f"RFF decision RMS error {fit_error:.4f} on {len(fit_points)} fit points "
+          f"(kernel expansion alone: {expansion_error:.4f})")
+    if len(fit_points) < num_components:
+        print(f"Fewer fit points than components: pass --calibration-data with more than {num_components} beats "
+              "for the correction to generalize")
+    if args.validation_data:
+        validation, labels = load_labelled(args.validation_data)
+        agreement = np.mean((rff_decision(validation) > 0) == (float_decision(validation) > 0))
+        rff_accuracy = np.mean(np.where(rff_decision(validation) > 0, svm_model.classes_[1],
+                                        svm_model.classes_[0]) == labels)
+        expansion_agreement = np.mean((rff_phi(validation) @ expansion_weights + bias > 0) ==
+                                      (float_decision(validation) > 0))
+        print(f"RFF validation accuracy {rff_accuracy:.4%}, {agreement:.4%} agreement with the float model "
+              f"(kernel expansion alone: {expansion_agreement:.4%})")
+    print(f"Per-window cost: {num_components * num_features} MACs + {num_components} cosf, "
+          f"exact kernel: {num_support_vectors * num_features} MACs + {num_support_vectors} expf")
+
+    rff_code = f"""// Random Fourier Feature Model Parameters
+// Auto-generated by SVM extraction script, use with SVM_ENGINE_RFF
+#pragma once
+#include "svm_model_params.h"
+
+static_assert(SVM_NUM_FEATURES == {num_features}, "svm_model_rff.h was generated for a different window size");
+
+constexpr int SVM_RFF_COMPONENTS = {num_components};
+constexpr float SVM_RFF_BIAS = {rff_bias:.9e}f;
+
+// Phases b of cos(Wx + b)
+"""
+    rff_code += c_array("float", "rffPhases", "SVM_RFF_COMPONENTS", rff_phases, "{:.9e}f")
+    rff_code += "\n// Linear weights, one per component\n"
+    rff_code += c_array("float", "rffWeights", "SVM_RFF_COMPONENTS", rff_weights, "{:.9e}f")
+    rff_code += "\n// Projection W (flattened, one row per component)\n"
+    rff_code += c_array("float", "rffProjection", "SVM_RFF_COMPONENTS * SVM_NUM_FEATURES",
+                        rff_projection.flatten(), "{:.7e}f")
+
+    with open('svm_model_rff.h', 'w') as f:
+        f.write(rff_code)
+    print("Random Fourier feature model saved to svm_model_rff.h")
+
 print("Integration instructions:")
 print("1. Copy svm_model_params.h to your ESP32 project folder")
-print("2. Include the header in your main sketch: #include \"svm_model_params.h\"")
-print("3. Replace the example model parameters in the sketch with the actual values")
+print("2. Rebuild the firmware; main.cpp compiles the model in from svm_model_params.h")
+step = 3
+if args.quantize != "none":
+    print(f"{step}. Copy svm_model_quantized.h too and build with -DSVM_ENGINE=SVM_ENGINE_QUANTIZED")
+    step += 1
+if args.rff:
+    print(f"{step}. Copy svm_model_rff.h too and build with -DSVM_ENGINE=SVM_ENGINE_RFF")
+if args.binary:
+    print(f"To swap models without reflashing: curl --data-binary @{args.binary} "
+          "-H 'Content-Type: application/octet-stream' http://<device>/model")
 print("Done!")
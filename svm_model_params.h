@@ -0,0 +1,1004 @@
+// SVM Model Parameters
+// Placeholder model so the firmware builds out of the box.
+// Replace by running svm-extraction.py on your trained model.
+// Input domain: the firmware classifies 140-sample beats in volts taken after
+// its filter cascade (0.5-40Hz band-pass and mains notch, zero-centred), and
+// standardizes them with the means below. The scaler must have been fitted on
+// beats in that domain, e.g. recorded by the device, not on raw ADC traces.
+#pragma once
+
+// Model configuration
+constexpr int SVM_NUM_SUPPORT_VECTORS = 50;
+constexpr int SVM_NUM_FEATURES = 140;
+constexpr float SVM_GAMMA = 0.01f;
+constexpr float SVM_BIAS = -0.5f;
+constexpr bool SVM_PREFILTER = false;  // svmPrefilterWeights is fitted
+constexpr float SVM_PREFILTER_BIAS = 0.000000000e+00f;
+constexpr float SVM_PREFILTER_THRESHOLD = 0.000000000e+00f;
+
+// Feature normalization parameters (means and inverse standard deviations)
+alignas(16) const float featureMeans[SVM_NUM_FEATURES] = {
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f
+};
+
+alignas(16) const float featureInverseStds[SVM_NUM_FEATURES] = {
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+    1.000000f, 1.000000f, 1.000000f, 1.000000f
+};
+
+// Support vector coefficients (alpha_i * y_i)
+alignas(16) const float svmCoefficients[SVM_NUM_SUPPORT_VECTORS] = {
+    1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f,
+    1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f,
+    1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f,
+    1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f,
+    1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f,
+    1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f, 1.000000f, -1.000000f,
+    1.000000f, -1.000000f
+};
+
+// Support vectors (flattened)
+alignas(16) const float supportVectors[SVM_NUM_SUPPORT_VECTORS * SVM_NUM_FEATURES] = {
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f,
+    0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.100000f, 0.200000f, 0.300000f,
+    0.400000f, 0.500000f, 0.600000f, 0.700000f, 0.800000f, 0.900000f, 1.000000f, 1.100000f,
+    1.200000f, 1.300000f, 1.400000f, 1.500000f, 1.600000f, 1.700000f, 1.800000f, 1.900000f,
+    2.000000f, 2.100000f, 2.200000f, 2.300000f, 2.400000f, 2.500000f, 2.600000f, 2.700000f,
+    2.800000f, 2.900000f, 3.000000f, 3.100000f, 3.200000f, 3.300000f, 3.400000f, 3.500000f,
+    3.600000f, 3.700000f, 3.800000f, 3.900000f, 4.000000f, 4.100000f, 4.200000f, 4.300000f,
+    4.400000f, 4.500000f, 4.600000f, 4.700000f, 4.800000f, 4.900000f, 5.000000f, 5.100000f,
+    5.200000f, 5.300000f, 5.400000f, 5.500000f, 5.600000f, 5.700000f, 5.800000f, 5.900000f,
+    6.000000f, 6.100000f, 6.200000f, 6.300000f, 6.400000f, 6.500000f, 6.600000f, 6.700000f,
+    6.800000f, 6.900000f, 7.000000f, 7.100000f, 7.200000f, 7.300000f, 7.400000f, 7.500000f,
+    7.600000f, 7.700000f, 7.800000f, 7.900000f, 8.000000f, 8.100000f, 8.200000f, 8.300000f,
+    8.400000f, 8.500000f, 8.600000f, 8.700000f, 8.800000f, 8.900000f, 9.000000f, 9.100000f,
+    9.200000f, 9.300000f, 9.400000f, 9.500000f, 9.600000f, 9.700000f, 9.800000f, 9.900000f,
+    10.000000f, 10.100000f, 10.200000f, 10.300000f, 10.400000f, 10.500000f, 10.600000f, 10.700000f,
+    10.800000f, 10.900000f, 11.000000f, 11.100000f, 11.200000f, 11.300000f, 11.400000f, 11.500000f,
+    11.600000f, 11.700000f, 11.800000f, 11.900000f, 12.000000f, 12.100000f, 12.200000f, 12.300000f,
+    12.400000f, 12.500000f, 12.600000f, 12.700000f, 12.800000f, 12.900000f, 13.000000f, 13.100000f,
+    13.200000f, 13.300000f, 13.400000f, 13.500000f, 13.600000f, 13.700000f, 13.800000f, 13.900000f,
+    0.000000f, 0.200000f, 0.400000f, 0.600000f, 0.800000f, 1.000000f, 1.200000f, 1.400000f,
+    1.600000f, 1.800000f, 2.000000f, 2.200000f, 2.400000f, 2.600000f, 2.800000f, 3.000000f,
+    3.200000f, 3.400000f, 3.600000f, 3.800000f, 4.000000f, 4.200000f, 4.400000f, 4.600000f,
+    4.800000f, 5.000000f, 5.200000f, 5.400000f, 5.600000f, 5.800000f, 6.000000f, 6.200000f,
+    6.400000f, 6.600000f, 6.800000f, 7.000000f, 7.200000f, 7.400000f, 7.600000f, 7.800000f,
+    8.000000f, 8.200000f, 8.400000f, 8.600000f, 8.800000f, 9.000000f, 9.200000f, 9.400000f,
+    9.600000f, 9.800000f, 10.000000f, 10.200000f, 10.400000f, 10.600000f, 10.800000f, 11.000000f,
+    11.200000f, 11.400000f, 11.600000f, 11.800000f, 12.000000f, 12.200000f, 12.400000f, 12.600000f,
+    12.800000f, 13.000000f, 13.200000f, 13.400000f, 13.600000f, 13.800000f, 14.000000f, 14.200000f,
+    14.400000f, 14.600000f, 14.800000f, 15.000000f, 15.200000f, 15.400000f, 15.600000f, 15.800000f,
+    16.000000f, 16.200000f, 16.400000f, 16.600000f, 16.800000f, 17.000000f, 17.200000f, 17.400000f,
+    17.600000f, 17.800000f, 18.000000f, 18.200000f, 18.400000f, 18.600000f, 18.800000f, 19.000000f,
+    19.200000f, 19.400000f, 19.600000f, 19.800000f, 20.000000f, 20.200000f, 20.400000f, 20.600000f,
+    20.800000f, 21.000000f, 21.200000f, 21.400000f, 21.600000f, 21.800000f, 22.000000f, 22.200000f,
+    22.400000f, 22.600000f, 22.800000f, 23.000000f, 23.200000f, 23.400000f, 23.600000f, 23.800000f,
+    24.000000f, 24.200000f, 24.400000f, 24.600000f, 24.800000f, 25.000000f, 25.200000f, 25.400000f,
+    25.600000f, 25.800000f, 26.000000f, 26.200000f, 26.400000f, 26.600000f, 26.800000f, 27.000000f,
+    27.200000f, 27.400000f, 27.600000f, 27.800000f, 0.000000f, 0.300000f, 0.600000f, 0.900000f,
+    1.200000f, 1.500000f, 1.800000f, 2.100000f, 2.400000f, 2.700000f, 3.000000f, 3.300000f,
+    3.600000f, 3.900000f, 4.200000f, 4.500000f, 4.800000f, 5.100000f, 5.400000f, 5.700000f,
+    6.000000f, 6.300000f, 6.600000f, 6.900000f, 7.200000f, 7.500000f, 7.800000f, 8.100000f,
+    8.400000f, 8.700000f, 9.000000f, 9.300000f, 9.600000f, 9.900000f, 10.200000f, 10.500000f,
+    10.800000f, 11.100000f, 11.400000f, 11.700000f, 12.000000f, 12.300000f, 12.600000f, 12.900000f,
+    13.200000f, 13.500000f, 13.800000f, 14.100000f, 14.400000f, 14.700000f, 15.000000f, 15.300000f,
+    15.600000f, 15.900000f, 16.200000f, 16.500000f, 16.800000f, 17.100000f, 17.400000f, 17.700000f,
+    18.000000f, 18.300000f, 18.600000f, 18.900000f, 19.200000f, 19.500000f, 19.800000f, 20.100000f,
+    20.400000f, 20.700000f, 21.000000f, 21.300000f, 21.600000f, 21.900000f, 22.200000f, 22.500000f,
+    22.800000f, 23.100000f, 23.400000f, 23.700000f, 24.000000f, 24.300000f, 24.600000f, 24.900000f,
+    25.200000f, 25.500000f, 25.800000f, 26.100000f, 26.400000f, 26.700000f, 27.000000f, 27.300000f,
+    27.600000f, 27.900000f, 28.200000f, 28.500000f, 28.800000f, 29.100000f, 29.400000f, 29.700000f,
+    30.000000f, 30.300000f, 30.600000f, 30.900000f, 31.200000f, 31.500000f, 31.800000f, 32.100000f,
+    32.400000f, 32.700000f, 33.000000f, 33.300000f, 33.600000f, 33.900000f, 34.200000f, 34.500000f,
+    34.800000f, 35.100000f, 35.400000f, 35.700000f, 36.000000f, 36.300000f, 36.600000f, 36.900000f,
+    37.200000f, 37.500000f, 37.800000f, 38.100000f, 38.400000f, 38.700000f, 39.000000f, 39.300000f,
+    39.600000f, 39.900000f, 40.200000f, 40.500000f, 40.800000f, 41.100000f, 41.400000f, 41.700000f,
+    0.000000f, 0.400000f, 0.800000f, 1.200000f, 1.600000f, 2.000000f, 2.400000f, 2.800000f,
+    3.200000f, 3.600000f, 4.000000f, 4.400000f, 4.800000f, 5.200000f, 5.600000f, 6.000000f,
+    6.400000f, 6.800000f, 7.200000f, 7.600000f, 8.000000f, 8.400000f, 8.800000f, 9.200000f,
+    9.600000f, 10.000000f, 10.400000f, 10.800000f, 11.200000f, 11.600000f, 12.000000f, 12.400000f,
+    12.800000f, 13.200000f, 13.600000f, 14.000000f, 14.400000f, 14.800000f, 15.200000f, 15.600000f,
+    16.000000f, 16.400000f, 16.800000f, 17.200000f, 17.600000f, 18.000000f, 18.400000f, 18.800000f,
+    19.200000f, 19.600000f, 20.000000f, 20.400000f, 20.800000f, 21.200000f, 21.600000f, 22.000000f,
+    22.400000f, 22.800000f, 23.200000f, 23.600000f, 24.000000f, 24.400000f, 24.800000f, 25.200000f,
+    25.600000f, 26.000000f, 26.400000f, 26.800000f, 27.200000f, 27.600000f, 28.000000f, 28.400000f,
+    28.800000f, 29.200000f, 29.600000f, 30.000000f, 30.400000f, 30.800000f, 31.200000f, 31.600000f,
+    32.000000f, 32.400000f, 32.800000f, 33.200000f, 33.600000f, 34.000000f, 34.400000f, 34.800000f,
+    35.200000f, 35.600000f, 36.000000f, 36.400000f, 36.800000f, 37.200000f, 37.600000f, 38.000000f,
+    38.400000f, 38.800000f, 39.200000f, 39.600000f, 40.000000f, 40.400000f, 40.800000f, 41.200000f,
+    41.600000f, 42.000000f, 42.400000f, 42.800000f, 43.200000f, 43.600000f, 44.000000f, 44.400000f,
+    44.800000f, 45.200000f, 45.600000f, 46.000000f, 46.400000f, 46.800000f, 47.200000f, 47.600000f,
+    48.000000f, 48.400000f, 48.800000f, 49.200000f, 49.600000f, 50.000000f, 50.400000f, 50.800000f,
+    51.200000f, 51.600000f, 52.000000f, 52.400000f, 52.800000f, 53.200000f, 53.600000f, 54.000000f,
+    54.400000f, 54.800000f, 55.200000f, 55.600000f, 0.000000f, 0.500000f, 1.000000f, 1.500000f,
+    2.000000f, 2.500000f, 3.000000f, 3.500000f, 4.000000f, 4.500000f, 5.000000f, 5.500000f,
+    6.000000f, 6.500000f, 7.000000f, 7.500000f, 8.000000f, 8.500000f, 9.000000f, 9.500000f,
+    10.000000f, 10.500000f, 11.000000f, 11.500000f, 12.000000f, 12.500000f, 13.000000f, 13.500000f,
+    14.000000f, 14.500000f, 15.000000f, 15.500000f, 16.000000f, 16.500000f, 17.000000f, 17.500000f,
+    18.000000f, 18.500000f, 19.000000f, 19.500000f, 20.000000f, 20.500000f, 21.000000f, 21.500000f,
+    22.000000f, 22.500000f, 23.000000f, 23.500000f, 24.000000f, 24.500000f, 25.000000f, 25.500000f,
+    26.000000f, 26.500000f, 27.000000f, 27.500000f, 28.000000f, 28.500000f, 29.000000f, 29.500000f,
+    30.000000f, 30.500000f, 31.000000f, 31.500000f, 32.000000f, 32.500000f, 33.000000f, 33.500000f,
+    34.000000f, 34.500000f, 35.000000f, 35.500000f, 36.000000f, 36.500000f, 37.000000f, 37.500000f,
+    38.000000f, 38.500000f, 39.000000f, 39.500000f, 40.000000f, 40.500000f, 41.000000f, 41.500000f,
+    42.000000f, 42.500000f, 43.000000f, 43.500000f, 44.000000f, 44.500000f, 45.000000f, 45.500000f,
+    46.000000f, 46.500000f, 47.000000f, 47.500000f, 48.000000f, 48.500000f, 49.000000f, 49.500000f,
+    50.000000f, 50.500000f, 51.000000f, 51.500000f, 52.000000f, 52.500000f, 53.000000f, 53.500000f,
+    54.000000f, 54.500000f, 55.000000f, 55.500000f, 56.000000f, 56.500000f, 57.000000f, 57.500000f,
+    58.000000f, 58.500000f, 59.000000f, 59.500000f, 60.000000f, 60.500000f, 61.000000f, 61.500000f,
+    62.000000f, 62.500000f, 63.000000f, 63.500000f, 64.000000f, 64.500000f, 65.000000f, 65.500000f,
+    66.000000f, 66.500000f, 67.000000f, 67.500000f, 68.000000f, 68.500000f, 69.000000f, 69.500000f,
+    0.000000f, 0.600000f, 1.200000f, 1.800000f, 2.400000f, 3.000000f, 3.600000f, 4.200000f,
+    4.800000f, 5.400000f, 6.000000f, 6.600000f, 7.200000f, 7.800000f, 8.400000f, 9.000000f,
+    9.600000f, 10.200000f, 10.800000f, 11.400000f, 12.000000f, 12.600000f, 13.200000f, 13.800000f,
+    14.400000f, 15.000000f, 15.600000f, 16.200000f, 16.800000f, 17.400000f, 18.000000f, 18.600000f,
+    19.200000f, 19.800000f, 20.400000f, 21.000000f, 21.600000f, 22.200000f, 22.800000f, 23.400000f,
+    24.000000f, 24.600000f, 25.200000f, 25.800000f, 26.400000f, 27.000000f, 27.600000f, 28.200000f,
+    28.800000f, 29.400000f, 30.000000f, 30.600000f, 31.200000f, 31.800000f, 32.400000f, 33.000000f,
+    33.600000f, 34.200000f, 34.800000f, 35.400000f, 36.000000f, 36.600000f, 37.200000f, 37.800000f,
+    38.400000f, 39.000000f, 39.600000f, 40.200000f, 40.800000f, 41.400000f, 42.000000f, 42.600000f,
+    43.200000f, 43.800000f, 44.400000f, 45.000000f, 45.600000f, 46.200000f, 46.800000f, 47.400000f,
+    48.000000f, 48.600000f, 49.200000f, 49.800000f, 50.400000f, 51.000000f, 51.600000f, 52.200000f,
+    52.800000f, 53.400000f, 54.000000f, 54.600000f, 55.200000f, 55.800000f, 56.400000f, 57.000000f,
+    57.600000f, 58.200000f, 58.800000f, 59.400000f, 60.000000f, 60.600000f, 61.200000f, 61.800000f,
+    62.400000f, 63.000000f, 63.600000f, 64.200000f, 64.800000f, 65.400000f, 66.000000f, 66.600000f,
+    67.200000f, 67.800000f, 68.400000f, 69.000000f, 69.600000f, 70.200000f, 70.800000f, 71.400000f,
+    72.000000f, 72.600000f, 73.200000f, 73.800000f, 74.400000f, 75.000000f, 75.600000f, 76.200000f,
+    76.800000f, 77.400000f, 78.000000f, 78.600000f, 79.200000f, 79.800000f, 80.400000f, 81.000000f,
+    81.600000f, 82.200000f, 82.800000f, 83.400000f, 0.000000f, 0.700000f, 1.400000f, 2.100000f,
+    2.800000f, 3.500000f, 4.200000f, 4.900000f, 5.600000f, 6.300000f, 7.000000f, 7.700000f,
+    8.400000f, 9.100000f, 9.800000f, 10.500000f, 11.200000f, 11.900000f, 12.600000f, 13.300000f,
+    14.000000f, 14.700000f, 15.400000f, 16.100000f, 16.800000f, 17.500000f, 18.200000f, 18.900000f,
+    19.600000f, 20.300000f, 21.000000f, 21.700000f, 22.400000f, 23.100000f, 23.800000f, 24.500000f,
+    25.200000f, 25.900000f, 26.600000f, 27.300000f, 28.000000f, 28.700000f, 29.400000f, 30.100000f,
+    30.800000f, 31.500000f, 32.200000f, 32.900000f, 33.600000f, 34.300000f, 35.000000f, 35.700000f,
+    36.400000f, 37.100000f, 37.800000f, 38.500000f, 39.200000f, 39.900000f, 40.600000f, 41.300000f,
+    42.000000f, 42.700000f, 43.400000f, 44.100000f, 44.800000f, 45.500000f, 46.200000f, 46.900000f,
+    47.600000f, 48.300000f, 49.000000f, 49.700000f, 50.400000f, 51.100000f, 51.800000f, 52.500000f,
+    53.200000f, 53.900000f, 54.600000f, 55.300000f, 56.000000f, 56.700000f, 57.400000f, 58.100000f,
+    58.800000f, 59.500000f, 60.200000f, 60.900000f, 61.600000f, 62.300000f, 63.000000f, 63.700000f,
+    64.400000f, 65.100000f, 65.800000f, 66.500000f, 67.200000f, 67.900000f, 68.600000f, 69.300000f,
+    70.000000f, 70.700000f, 71.400000f, 72.100000f, 72.800000f, 73.500000f, 74.200000f, 74.900000f,
+    75.600000f, 76.300000f, 77.000000f, 77.700000f, 78.400000f, 79.100000f, 79.800000f, 80.500000f,
+    81.200000f, 81.900000f, 82.600000f, 83.300000f, 84.000000f, 84.700000f, 85.400000f, 86.100000f,
+    86.800000f, 87.500000f, 88.200000f, 88.900000f, 89.600000f, 90.300000f, 91.000000f, 91.700000f,
+    92.400000f, 93.100000f, 93.800000f, 94.500000f, 95.200000f, 95.900000f, 96.600000f, 97.300000f,
+    0.000000f, 0.800000f, 1.600000f, 2.400000f, 3.200000f, 4.000000f, 4.800000f, 5.600000f,
+    6.400000f, 7.200000f, 8.000000f, 8.800000f, 9.600000f, 10.400000f, 11.200000f, 12.000000f,
+    12.800000f, 13.600000f, 14.400000f, 15.200000f, 16.000000f, 16.800000f, 17.600000f, 18.400000f,
+    19.200000f, 20.000000f, 20.800000f, 21.600000f, 22.400000f, 23.200000f, 24.000000f, 24.800000f,
+    25.600000f, 26.400000f, 27.200000f, 28.000000f, 28.800000f, 29.600000f, 30.400000f, 31.200000f,
+    32.000000f, 32.800000f, 33.600000f, 34.400000f, 35.200000f, 36.000000f, 36.800000f, 37.600000f,
+    38.400000f, 39.200000f, 40.000000f, 40.800000f, 41.600000f, 42.400000f, 43.200000f, 44.000000f,
+    44.800000f, 45.600000f, 46.400000f, 47.200000f, 48.000000f, 48.800000f, 49.600000f, 50.400000f,
+    51.200000f, 52.000000f, 52.800000f, 53.600000f, 54.400000f, 55.200000f, 56.000000f, 56.800000f,
+    57.600000f, 58.400000f, 59.200000f, 60.000000f, 60.800000f, 61.600000f, 62.400000f, 63.200000f,
+    64.000000f, 64.800000f, 65.600000f, 66.400000f, 67.200000f, 68.000000f, 68.800000f, 69.600000f,
+    70.400000f, 71.200000f, 72.000000f, 72.800000f, 73.600000f, 74.400000f, 75.200000f, 76.000000f,
+    76.800000f, 77.600000f, 78.400000f, 79.200000f, 80.000000f, 80.800000f, 81.600000f, 82.400000f,
+    83.200000f, 84.000000f, 84.800000f, 85.600000f, 86.400000f, 87.200000f, 88.000000f, 88.800000f,
+    89.600000f, 90.400000f, 91.200000f, 92.000000f, 92.800000f, 93.600000f, 94.400000f, 95.200000f,
+    96.000000f, 96.800000f, 97.600000f, 98.400000f, 99.200000f, 100.000000f, 100.800000f, 101.600000f,
+    102.400000f, 103.200000f, 104.000000f, 104.800000f, 105.600000f, 106.400000f, 107.200000f, 108.000000f,
+    108.800000f, 109.600000f, 110.400000f, 111.200000f, 0.000000f, 0.900000f, 1.800000f, 2.700000f,
+    3.600000f, 4.500000f, 5.400000f, 6.300000f, 7.200000f, 8.100000f, 9.000000f, 9.900000f,
+    10.800000f, 11.700000f, 12.600000f, 13.500000f, 14.400000f, 15.300000f, 16.200000f, 17.100000f,
+    18.000000f, 18.900000f, 19.800000f, 20.700000f, 21.600000f, 22.500000f, 23.400000f, 24.300000f,
+    25.200000f, 26.100000f, 27.000000f, 27.900000f, 28.800000f, 29.700000f, 30.600000f, 31.500000f,
+    32.400000f, 33.300000f, 34.200000f, 35.100000f, 36.000000f, 36.900000f, 37.800000f, 38.700000f,
+    39.600000f, 40.500000f, 41.400000f, 42.300000f, 43.200000f, 44.100000f, 45.000000f, 45.900000f,
+    46.800000f, 47.700000f, 48.600000f, 49.500000f, 50.400000f, 51.300000f, 52.200000f, 53.100000f,
+    54.000000f, 54.900000f, 55.800000f, 56.700000f, 57.600000f, 58.500000f, 59.400000f, 60.300000f,
+    61.200000f, 62.100000f, 63.000000f, 63.900000f, 64.800000f, 65.700000f, 66.600000f, 67.500000f,
+    68.400000f, 69.300000f, 70.200000f, 71.100000f, 72.000000f, 72.900000f, 73.800000f, 74.700000f,
+    75.600000f, 76.500000f, 77.400000f, 78.300000f, 79.200000f, 80.100000f, 81.000000f, 81.900000f,
+    82.800000f, 83.700000f, 84.600000f, 85.500000f, 86.400000f, 87.300000f, 88.200000f, 89.100000f,
+    90.000000f, 90.900000f, 91.800000f, 92.700000f, 93.600000f, 94.500000f, 95.400000f, 96.300000f,
+    97.200000f, 98.100000f, 99.000000f, 99.900000f, 100.800000f, 101.700000f, 102.600000f, 103.500000f,
+    104.400000f, 105.300000f, 106.200000f, 107.100000f, 108.000000f, 108.900000f, 109.800000f, 110.700000f,
+    111.600000f, 112.500000f, 113.400000f, 114.300000f, 115.200000f, 116.100000f, 117.000000f, 117.900000f,
+    118.800000f, 119.700000f, 120.600000f, 121.500000f, 122.400000f, 123.300000f, 124.200000f, 125.100000f,
+    0.000000f, 1.000000f, 2.000000f, 3.000000f, 4.000000f, 5.000000f, 6.000000f, 7.000000f,
+    8.000000f, 9.000000f, 10.000000f, 11.000000f, 12.000000f, 13.000000f, 14.000000f, 15.000000f,
+    16.000000f, 17.000000f, 18.000000f, 19.000000f, 20.000000f, 21.000000f, 22.000000f, 23.000000f,
+    24.000000f, 25.000000f, 26.000000f, 27.000000f, 28.000000f, 29.000000f, 30.000000f, 31.000000f,
+    32.000000f, 33.000000f, 34.000000f, 35.000000f, 36.000000f, 37.000000f, 38.000000f, 39.000000f,
+    40.000000f, 41.000000f, 42.000000f, 43.000000f, 44.000000f, 45.000000f, 46.000000f, 47.000000f,
+    48.000000f, 49.000000f, 50.000000f, 51.000000f, 52.000000f, 53.000000f, 54.000000f, 55.000000f,
+    56.000000f, 57.000000f, 58.000000f, 59.000000f, 60.000000f, 61.000000f, 62.000000f, 63.000000f,
+    64.000000f, 65.000000f, 66.000000f, 67.000000f, 68.000000f, 69.000000f, 70.000000f, 71.000000f,
+    72.000000f, 73.000000f, 74.000000f, 75.000000f, 76.000000f, 77.000000f, 78.000000f, 79.000000f,
+    80.000000f, 81.000000f, 82.000000f, 83.000000f, 84.000000f, 85.000000f, 86.000000f, 87.000000f,
+    88.000000f, 89.000000f, 90.000000f, 91.000000f, 92.000000f, 93.000000f, 94.000000f, 95.000000f,
+    96.000000f, 97.000000f, 98.000000f, 99.000000f, 100.000000f, 101.000000f, 102.000000f, 103.000000f,
+    104.000000f, 105.000000f, 106.000000f, 107.000000f, 108.000000f, 109.000000f, 110.000000f, 111.000000f,
+    112.000000f, 113.000000f, 114.000000f, 115.000000f, 116.000000f, 117.000000f, 118.000000f, 119.000000f,
+    120.000000f, 121.000000f, 122.000000f, 123.000000f, 124.000000f, 125.000000f, 126.000000f, 127.000000f,
+    128.000000f, 129.000000f, 130.000000f, 131.000000f, 132.000000f, 133.000000f, 134.000000f, 135.000000f,
+    136.000000f, 137.000000f, 138.000000f, 139.000000f, 0.000000f, 1.100000f, 2.200000f, 3.300000f,
+    4.400000f, 5.500000f, 6.600000f, 7.700000f, 8.800000f, 9.900000f, 11.000000f, 12.100000f,
+    13.200000f, 14.300000f, 15.400000f, 16.500000f, 17.600000f, 18.700000f, 19.800000f, 20.900000f,
+    22.000000f, 23.100000f, 24.200000f, 25.300000f, 26.400000f, 27.500000f, 28.600000f, 29.700000f,
+    30.800000f, 31.900000f, 33.000000f, 34.100000f, 35.200000f, 36.300000f, 37.400000f, 38.500000f,
+    39.600000f, 40.700000f, 41.800000f, 42.900000f, 44.000000f, 45.100000f, 46.200000f, 47.300000f,
+    48.400000f, 49.500000f, 50.600000f, 51.700000f, 52.800000f, 53.900000f, 55.000000f, 56.100000f,
+    57.200000f, 58.300000f, 59.400000f, 60.500000f, 61.600000f, 62.700000f, 63.800000f, 64.900000f,
+    66.000000f, 67.100000f, 68.200000f, 69.300000f, 70.400000f, 71.500000f, 72.600000f, 73.700000f,
+    74.800000f, 75.900000f, 77.000000f, 78.100000f, 79.200000f, 80.300000f, 81.400000f, 82.500000f,
+    83.600000f, 84.700000f, 85.800000f, 86.900000f, 88.000000f, 89.100000f, 90.200000f, 91.300000f,
+    92.400000f, 93.500000f, 94.600000f, 95.700000f, 96.800000f, 97.900000f, 99.000000f, 100.100000f,
+    101.200000f, 102.300000f, 103.400000f, 104.500000f, 105.600000f, 106.700000f, 107.800000f, 108.900000f,
+    110.000000f, 111.100000f, 112.200000f, 113.300000f, 114.400000f, 115.500000f, 116.600000f, 117.700000f,
+    118.800000f, 119.900000f, 121.000000f, 122.100000f, 123.200000f, 124.300000f, 125.400000f, 126.500000f,
+    127.600000f, 128.700000f, 129.800000f, 130.900000f, 132.000000f, 133.100000f, 134.200000f, 135.300000f,
+    136.400000f, 137.500000f, 138.600000f, 139.700000f, 140.800000f, 141.900000f, 143.000000f, 144.100000f,
+    145.200000f, 146.300000f, 147.400000f, 148.500000f, 149.600000f, 150.700000f, 151.800000f, 152.900000f,
+    0.000000f, 1.200000f, 2.400000f, 3.600000f, 4.800000f, 6.000000f, 7.200000f, 8.400000f,
+    9.600000f, 10.800000f, 12.000000f, 13.200000f, 14.400000f, 15.600000f, 16.800000f, 18.000000f,
+    19.200000f, 20.400000f, 21.600000f, 22.800000f, 24.000000f, 25.200000f, 26.400000f, 27.600000f,
+    28.800000f, 30.000000f, 31.200000f, 32.400000f, 33.600000f, 34.800000f, 36.000000f, 37.200000f,
+    38.400000f, 39.600000f, 40.800000f, 42.000000f, 43.200000f, 44.400000f, 45.600000f, 46.800000f,
+    48.000000f, 49.200000f, 50.400000f, 51.600000f, 52.800000f, 54.000000f, 55.200000f, 56.400000f,
+    57.600000f, 58.800000f, 60.000000f, 61.200000f, 62.400000f, 63.600000f, 64.800000f, 66.000000f,
+    67.200000f, 68.400000f, 69.600000f, 70.800000f, 72.000000f, 73.200000f, 74.400000f, 75.600000f,
+    76.800000f, 78.000000f, 79.200000f, 80.400000f, 81.600000f, 82.800000f, 84.000000f, 85.200000f,
+    86.400000f, 87.600000f, 88.800000f, 90.000000f, 91.200000f, 92.400000f, 93.600000f, 94.800000f,
+    96.000000f, 97.200000f, 98.400000f, 99.600000f, 100.800000f, 102.000000f, 103.200000f, 104.400000f,
+    105.600000f, 106.800000f, 108.000000f, 109.200000f, 110.400000f, 111.600000f, 112.800000f, 114.000000f,
+    115.200000f, 116.400000f, 117.600000f, 118.800000f, 120.000000f, 121.200000f, 122.400000f, 123.600000f,
+    124.800000f, 126.000000f, 127.200000f, 128.400000f, 129.600000f, 130.800000f, 132.000000f, 133.200000f,
+    134.400000f, 135.600000f, 136.800000f, 138.000000f, 139.200000f, 140.400000f, 141.600000f, 142.800000f,
+    144.000000f, 145.200000f, 146.400000f, 147.600000f, 148.800000f, 150.000000f, 151.200000f, 152.400000f,
+    153.600000f, 154.800000f, 156.000000f, 157.200000f, 158.400000f, 159.600000f, 160.800000f, 162.000000f,
+    163.200000f, 164.400000f, 165.600000f, 166.800000f, 0.000000f, 1.300000f, 2.600000f, 3.900000f,
+    5.200000f, 6.500000f, 7.800000f, 9.100000f, 10.400000f, 11.700000f, 13.000000f, 14.300000f,
+    15.600000f, 16.900000f, 18.200000f, 19.500000f, 20.800000f, 22.100000f, 23.400000f, 24.700000f,
+    26.000000f, 27.300000f, 28.600000f, 29.900000f, 31.200000f, 32.500000f, 33.800000f, 35.100000f,
+    36.400000f, 37.700000f, 39.000000f, 40.300000f, 41.600000f, 42.900000f, 44.200000f, 45.500000f,
+    46.800000f, 48.100000f, 49.400000f, 50.700000f, 52.000000f, 53.300000f, 54.600000f, 55.900000f,
+    57.200000f, 58.500000f, 59.800000f, 61.100000f, 62.400000f, 63.700000f, 65.000000f, 66.300000f,
+    67.600000f, 68.900000f, 70.200000f, 71.500000f, 72.800000f, 74.100000f, 75.400000f, 76.700000f,
+    78.000000f, 79.300000f, 80.600000f, 81.900000f, 83.200000f, 84.500000f, 85.800000f, 87.100000f,
+    88.400000f, 89.700000f, 91.000000f, 92.300000f, 93.600000f, 94.900000f, 96.200000f, 97.500000f,
+    98.800000f, 100.100000f, 101.400000f, 102.700000f, 104.000000f, 105.300000f, 106.600000f, 107.900000f,
+    109.200000f, 110.500000f, 111.800000f, 113.100000f, 114.400000f, 115.700000f, 117.000000f, 118.300000f,
+    119.600000f, 120.900000f, 122.200000f, 123.500000f, 124.800000f, 126.100000f, 127.400000f, 128.700000f,
+    130.000000f, 131.300000f, 132.600000f, 133.900000f, 135.200000f, 136.500000f, 137.800000f, 139.100000f,
+    140.400000f, 141.700000f, 143.000000f, 144.300000f, 145.600000f, 146.900000f, 148.200000f, 149.500000f,
+    150.800000f, 152.100000f, 153.400000f, 154.700000f, 156.000000f, 157.300000f, 158.600000f, 159.900000f,
+    161.200000f, 162.500000f, 163.800000f, 165.100000f, 166.400000f, 167.700000f, 169.000000f, 170.300000f,
+    171.600000f, 172.900000f, 174.200000f, 175.500000f, 176.800000f, 178.100000f, 179.400000f, 180.700000f,
+    0.000000f, 1.400000f, 2.800000f, 4.200000f, 5.600000f, 7.000000f, 8.400000f, 9.800000f,
+    11.200000f, 12.600000f, 14.000000f, 15.400000f, 16.800000f, 18.200000f, 19.600000f, 21.000000f,
+    22.400000f, 23.800000f, 25.200000f, 26.600000f, 28.000000f, 29.400000f, 30.800000f, 32.200000f,
+    33.600000f, 35.000000f, 36.400000f, 37.800000f, 39.200000f, 40.600000f, 42.000000f, 43.400000f,
+    44.800000f, 46.200000f, 47.600000f, 49.000000f, 50.400000f, 51.800000f, 53.200000f, 54.600000f,
+    56.000000f, 57.400000f, 58.800000f, 60.200000f, 61.600000f, 63.000000f, 64.400000f, 65.800000f,
+    67.200000f, 68.600000f, 70.000000f, 71.400000f, 72.800000f, 74.200000f, 75.600000f, 77.000000f,
+    78.400000f, 79.800000f, 81.200000f, 82.600000f, 84.000000f, 85.400000f, 86.800000f, 88.200000f,
+    89.600000f, 91.000000f, 92.400000f, 93.800000f, 95.200000f, 96.600000f, 98.000000f, 99.400000f,
+    100.800000f, 102.200000f, 103.600000f, 105.000000f, 106.400000f, 107.800000f, 109.200000f, 110.600000f,
+    112.000000f, 113.400000f, 114.800000f, 116.200000f, 117.600000f, 119.000000f, 120.400000f, 121.800000f,
+    123.200000f, 124.600000f, 126.000000f, 127.400000f, 128.800000f, 130.200000f, 131.600000f, 133.000000f,
+    134.400000f, 135.800000f, 137.200000f, 138.600000f, 140.000000f, 141.400000f, 142.800000f, 144.200000f,
+    145.600000f, 147.000000f, 148.400000f, 149.800000f, 151.200000f, 152.600000f, 154.000000f, 155.400000f,
+    156.800000f, 158.200000f, 159.600000f, 161.000000f, 162.400000f, 163.800000f, 165.200000f, 166.600000f,
+    168.000000f, 169.400000f, 170.800000f, 172.200000f, 173.600000f, 175.000000f, 176.400000f, 177.800000f,
+    179.200000f, 180.600000f, 182.000000f, 183.400000f, 184.800000f, 186.200000f, 187.600000f, 189.000000f,
+    190.400000f, 191.800000f, 193.200000f, 194.600000f, 0.000000f, 1.500000f, 3.000000f, 4.500000f,
+    6.000000f, 7.500000f, 9.000000f, 10.500000f, 12.000000f, 13.500000f, 15.000000f, 16.500000f,
+    18.000000f, 19.500000f, 21.000000f, 22.500000f, 24.000000f, 25.500000f, 27.000000f, 28.500000f,
+    30.000000f, 31.500000f, 33.000000f, 34.500000f, 36.000000f, 37.500000f, 39.000000f, 40.500000f,
+    42.000000f, 43.500000f, 45.000000f, 46.500000f, 48.000000f, 49.500000f, 51.000000f, 52.500000f,
+    54.000000f, 55.500000f, 57.000000f, 58.500000f, 60.000000f, 61.500000f, 63.000000f, 64.500000f,
+    66.000000f, 67.500000f, 69.000000f, 70.500000f, 72.000000f, 73.500000f, 75.000000f, 76.500000f,
+    78.000000f, 79.500000f, 81.000000f, 82.500000f, 84.000000f, 85.500000f, 87.000000f, 88.500000f,
+    90.000000f, 91.500000f, 93.000000f, 94.500000f, 96.000000f, 97.500000f, 99.000000f, 100.500000f,
+    102.000000f, 103.500000f, 105.000000f, 106.500000f, 108.000000f, 109.500000f, 111.000000f, 112.500000f,
+    114.000000f, 115.500000f, 117.000000f, 118.500000f, 120.000000f, 121.500000f, 123.000000f, 124.500000f,
+    126.000000f, 127.500000f, 129.000000f, 130.500000f, 132.000000f, 133.500000f, 135.000000f, 136.500000f,
+    138.000000f, 139.500000f, 141.000000f, 142.500000f, 144.000000f, 145.500000f, 147.000000f, 148.500000f,
+    150.000000f, 151.500000f, 153.000000f, 154.500000f, 156.000000f, 157.500000f, 159.000000f, 160.500000f,
+    162.000000f, 163.500000f, 165.000000f, 166.500000f, 168.000000f, 169.500000f, 171.000000f, 172.500000f,
+    174.000000f, 175.500000f, 177.000000f, 178.500000f, 180.000000f, 181.500000f, 183.000000f, 184.500000f,
+    186.000000f, 187.500000f, 189.000000f, 190.500000f, 192.000000f, 193.500000f, 195.000000f, 196.500000f,
+    198.000000f, 199.500000f, 201.000000f, 202.500000f, 204.000000f, 205.500000f, 207.000000f, 208.500000f,
+    0.000000f, 1.600000f, 3.200000f, 4.800000f, 6.400000f, 8.000000f, 9.600000f, 11.200000f,
+    12.800000f, 14.400000f, 16.000000f, 17.600000f, 19.200000f, 20.800000f, 22.400000f, 24.000000f,
+    25.600000f, 27.200000f, 28.800000f, 30.400000f, 32.000000f, 33.600000f, 35.200000f, 36.800000f,
+    38.400000f, 40.000000f, 41.600000f, 43.200000f, 44.800000f, 46.400000f, 48.000000f, 49.600000f,
+    51.200000f, 52.800000f, 54.400000f, 56.000000f, 57.600000f, 59.200000f, 60.800000f, 62.400000f,
+    64.000000f, 65.600000f, 67.200000f, 68.800000f, 70.400000f, 72.000000f, 73.600000f, 75.200000f,
+    76.800000f, 78.400000f, 80.000000f, 81.600000f, 83.200000f, 84.800000f, 86.400000f, 88.000000f,
+    89.600000f, 91.200000f, 92.800000f, 94.400000f, 96.000000f, 97.600000f, 99.200000f, 100.800000f,
+    102.400000f, 104.000000f, 105.600000f, 107.200000f, 108.800000f, 110.400000f, 112.000000f, 113.600000f,
+    115.200000f, 116.800000f, 118.400000f, 120.000000f, 121.600000f, 123.200000f, 124.800000f, 126.400000f,
+    128.000000f, 129.600000f, 131.200000f, 132.800000f, 134.400000f, 136.000000f, 137.600000f, 139.200000f,
+    140.800000f, 142.400000f, 144.000000f, 145.600000f, 147.200000f, 148.800000f, 150.400000f, 152.000000f,
+    153.600000f, 155.200000f, 156.800000f, 158.400000f, 160.000000f, 161.600000f, 163.200000f, 164.800000f,
+    166.400000f, 168.000000f, 169.600000f, 171.200000f, 172.800000f, 174.400000f, 176.000000f, 177.600000f,
+    179.200000f, 180.800000f, 182.400000f, 184.000000f, 185.600000f, 187.200000f, 188.800000f, 190.400000f,
+    192.000000f, 193.600000f, 195.200000f, 196.800000f, 198.400000f, 200.000000f, 201.600000f, 203.200000f,
+    204.800000f, 206.400000f, 208.000000f, 209.600000f, 211.200000f, 212.800000f, 214.400000f, 216.000000f,
+    217.600000f, 219.200000f, 220.800000f, 222.400000f, 0.000000f, 1.700000f, 3.400000f, 5.100000f,
+    6.800000f, 8.500000f, 10.200000f, 11.900000f, 13.600000f, 15.300000f, 17.000000f, 18.700000f,
+    20.400000f, 22.100000f, 23.800000f, 25.500000f, 27.200000f, 28.900000f, 30.600000f, 32.300000f,
+    34.000000f, 35.700000f, 37.400000f, 39.100000f, 40.800000f, 42.500000f, 44.200000f, 45.900000f,
+    47.600000f, 49.300000f, 51.000000f, 52.700000f, 54.400000f, 56.100000f, 57.800000f, 59.500000f,
+    61.200000f, 62.900000f, 64.600000f, 66.300000f, 68.000000f, 69.700000f, 71.400000f, 73.100000f,
+    74.800000f, 76.500000f, 78.200000f, 79.900000f, 81.600000f, 83.300000f, 85.000000f, 86.700000f,
+    88.400000f, 90.100000f, 91.800000f, 93.500000f, 95.200000f, 96.900000f, 98.600000f, 100.300000f,
+    102.000000f, 103.700000f, 105.400000f, 107.100000f, 108.800000f, 110.500000f, 112.200000f, 113.900000f,
+    115.600000f, 117.300000f, 119.000000f, 120.700000f, 122.400000f, 124.100000f, 125.800000f, 127.500000f,
+    129.200000f, 130.900000f, 132.600000f, 134.300000f, 136.000000f, 137.700000f, 139.400000f, 141.100000f,
+    142.800000f, 144.500000f, 146.200000f, 147.900000f, 149.600000f, 151.300000f, 153.000000f, 154.700000f,
+    156.400000f, 158.100000f, 159.800000f, 161.500000f, 163.200000f, 164.900000f, 166.600000f, 168.300000f,
+    170.000000f, 171.700000f, 173.400000f, 175.100000f, 176.800000f, 178.500000f, 180.200000f, 181.900000f,
+    183.600000f, 185.300000f, 187.000000f, 188.700000f, 190.400000f, 192.100000f, 193.800000f, 195.500000f,
+    197.200000f, 198.900000f, 200.600000f, 202.300000f, 204.000000f, 205.700000f, 207.400000f, 209.100000f,
+    210.800000f, 212.500000f, 214.200000f, 215.900000f, 217.600000f, 219.300000f, 221.000000f, 222.700000f,
+    224.400000f, 226.100000f, 227.800000f, 229.500000f, 231.200000f, 232.900000f, 234.600000f, 236.300000f,
+    0.000000f, 1.800000f, 3.600000f, 5.400000f, 7.200000f, 9.000000f, 10.800000f, 12.600000f,
+    14.400000f, 16.200000f, 18.000000f, 19.800000f, 21.600000f, 23.400000f, 25.200000f, 27.000000f,
+    28.800000f, 30.600000f, 32.400000f, 34.200000f, 36.000000f, 37.800000f, 39.600000f, 41.400000f,
+    43.200000f, 45.000000f, 46.800000f, 48.600000f, 50.400000f, 52.200000f, 54.000000f, 55.800000f,
+    57.600000f, 59.400000f, 61.200000f, 63.000000f, 64.800000f, 66.600000f, 68.400000f, 70.200000f,
+    72.000000f, 73.800000f, 75.600000f, 77.400000f, 79.200000f, 81.000000f, 82.800000f, 84.600000f,
+    86.400000f, 88.200000f, 90.000000f, 91.800000f, 93.600000f, 95.400000f, 97.200000f, 99.000000f,
+    100.800000f, 102.600000f, 104.400000f, 106.200000f, 108.000000f, 109.800000f, 111.600000f, 113.400000f,
+    115.200000f, 117.000000f, 118.800000f, 120.600000f, 122.400000f, 124.200000f, 126.000000f, 127.800000f,
+    129.600000f, 131.400000f, 133.200000f, 135.000000f, 136.800000f, 138.600000f, 140.400000f, 142.200000f,
+    144.000000f, 145.800000f, 147.600000f, 149.400000f, 151.200000f, 153.000000f, 154.800000f, 156.600000f,
+    158.400000f, 160.200000f, 162.000000f, 163.800000f, 165.600000f, 167.400000f, 169.200000f, 171.000000f,
+    172.800000f, 174.600000f, 176.400000f, 178.200000f, 180.000000f, 181.800000f, 183.600000f, 185.400000f,
+    187.200000f, 189.000000f, 190.800000f, 192.600000f, 194.400000f, 196.200000f, 198.000000f, 199.800000f,
+    201.600000f, 203.400000f, 205.200000f, 207.000000f, 208.800000f, 210.600000f, 212.400000f, 214.200000f,
+    216.000000f, 217.800000f, 219.600000f, 221.400000f, 223.200000f, 225.000000f, 226.800000f, 228.600000f,
+    230.400000f, 232.200000f, 234.000000f, 235.800000f, 237.600000f, 239.400000f, 241.200000f, 243.000000f,
+    244.800000f, 246.600000f, 248.400000f, 250.200000f, 0.000000f, 1.900000f, 3.800000f, 5.700000f,
+    7.600000f, 9.500000f, 11.400000f, 13.300000f, 15.200000f, 17.100000f, 19.000000f, 20.900000f,
+    22.800000f, 24.700000f, 26.600000f, 28.500000f, 30.400000f, 32.300000f, 34.200000f, 36.100000f,
+    38.000000f, 39.900000f, 41.800000f, 43.700000f, 45.600000f, 47.500000f, 49.400000f, 51.300000f,
+    53.200000f, 55.100000f, 57.000000f, 58.900000f, 60.800000f, 62.700000f, 64.600000f, 66.500000f,
+    68.400000f, 70.300000f, 72.200000f, 74.100000f, 76.000000f, 77.900000f, 79.800000f, 81.700000f,
+    83.600000f, 85.500000f, 87.400000f, 89.300000f, 91.200000f, 93.100000f, 95.000000f, 96.900000f,
+    98.800000f, 100.700000f, 102.600000f, 104.500000f, 106.400000f, 108.300000f, 110.200000f, 112.100000f,
+    114.000000f, 115.900000f, 117.800000f, 119.700000f, 121.600000f, 123.500000f, 125.400000f, 127.300000f,
+    129.200000f, 131.100000f, 133.000000f, 134.900000f, 136.800000f, 138.700000f, 140.600000f, 142.500000f,
+    144.400000f, 146.300000f, 148.200000f, 150.100000f, 152.000000f, 153.900000f, 155.800000f, 157.700000f,
+    159.600000f, 161.500000f, 163.400000f, 165.300000f, 167.200000f, 169.100000f, 171.000000f, 172.900000f,
+    174.800000f, 176.700000f, 178.600000f, 180.500000f, 182.400000f, 184.300000f, 186.200000f, 188.100000f,
+    190.000000f, 191.900000f, 193.800000f, 195.700000f, 197.600000f, 199.500000f, 201.400000f, 203.300000f,
+    205.200000f, 207.100000f, 209.000000f, 210.900000f, 212.800000f, 214.700000f, 216.600000f, 218.500000f,
+    220.400000f, 222.300000f, 224.200000f, 226.100000f, 228.000000f, 229.900000f, 231.800000f, 233.700000f,
+    235.600000f, 237.500000f, 239.400000f, 241.300000f, 243.200000f, 245.100000f, 247.000000f, 248.900000f,
+    250.800000f, 252.700000f, 254.600000f, 256.500000f, 258.400000f, 260.300000f, 262.200000f, 264.100000f,
+    0.000000f, 2.000000f, 4.000000f, 6.000000f, 8.000000f, 10.000000f, 12.000000f, 14.000000f,
+    16.000000f, 18.000000f, 20.000000f, 22.000000f, 24.000000f, 26.000000f, 28.000000f, 30.000000f,
+    32.000000f, 34.000000f, 36.000000f, 38.000000f, 40.000000f, 42.000000f, 44.000000f, 46.000000f,
+    48.000000f, 50.000000f, 52.000000f, 54.000000f, 56.000000f, 58.000000f, 60.000000f, 62.000000f,
+    64.000000f, 66.000000f, 68.000000f, 70.000000f, 72.000000f, 74.000000f, 76.000000f, 78.000000f,
+    80.000000f, 82.000000f, 84.000000f, 86.000000f, 88.000000f, 90.000000f, 92.000000f, 94.000000f,
+    96.000000f, 98.000000f, 100.000000f, 102.000000f, 104.000000f, 106.000000f, 108.000000f, 110.000000f,
+    112.000000f, 114.000000f, 116.000000f, 118.000000f, 120.000000f, 122.000000f, 124.000000f, 126.000000f,
+    128.000000f, 130.000000f, 132.000000f, 134.000000f, 136.000000f, 138.000000f, 140.000000f, 142.000000f,
+    144.000000f, 146.000000f, 148.000000f, 150.000000f, 152.000000f, 154.000000f, 156.000000f, 158.000000f,
+    160.000000f, 162.000000f, 164.000000f, 166.000000f, 168.000000f, 170.000000f, 172.000000f, 174.000000f,
+    176.000000f, 178.000000f, 180.000000f, 182.000000f, 184.000000f, 186.000000f, 188.000000f, 190.000000f,
+    192.000000f, 194.000000f, 196.000000f, 198.000000f, 200.000000f, 202.000000f, 204.000000f, 206.000000f,
+    208.000000f, 210.000000f, 212.000000f, 214.000000f, 216.000000f, 218.000000f, 220.000000f, 222.000000f,
+    224.000000f, 226.000000f, 228.000000f, 230.000000f, 232.000000f, 234.000000f, 236.000000f, 238.000000f,
+    240.000000f, 242.000000f, 244.000000f, 246.000000f, 248.000000f, 250.000000f, 252.000000f, 254.000000f,
+    256.000000f, 258.000000f, 260.000000f, 262.000000f, 264.000000f, 266.000000f, 268.000000f, 270.000000f,
+    272.000000f, 274.000000f, 276.000000f, 278.000000f, 0.000000f, 2.100000f, 4.200000f, 6.300000f,
+    8.400000f, 10.500000f, 12.600000f, 14.700000f, 16.800000f, 18.900000f, 21.000000f, 23.100000f,
+    25.200000f, 27.300000f, 29.400000f, 31.500000f, 33.600000f, 35.700000f, 37.800000f, 39.900000f,
+    42.000000f, 44.100000f, 46.200000f, 48.300000f, 50.400000f, 52.500000f, 54.600000f, 56.700000f,
+    58.800000f, 60.900000f, 63.000000f, 65.100000f, 67.200000f, 69.300000f, 71.400000f, 73.500000f,
+    75.600000f, 77.700000f, 79.800000f, 81.900000f, 84.000000f, 86.100000f, 88.200000f, 90.300000f,
+    92.400000f, 94.500000f, 96.600000f, 98.700000f, 100.800000f, 102.900000f, 105.000000f, 107.100000f,
+    109.200000f, 111.300000f, 113.400000f, 115.500000f, 117.600000f, 119.700000f, 121.800000f, 123.900000f,
+    126.000000f, 128.100000f, 130.200000f, 132.300000f, 134.400000f, 136.500000f, 138.600000f, 140.700000f,
+    142.800000f, 144.900000f, 147.000000f, 149.100000f, 151.200000f, 153.300000f, 155.400000f, 157.500000f,
+    159.600000f, 161.700000f, 163.800000f, 165.900000f, 168.000000f, 170.100000f, 172.200000f, 174.300000f,
+    176.400000f, 178.500000f, 180.600000f, 182.700000f, 184.800000f, 186.900000f, 189.000000f, 191.100000f,
+    193.200000f, 195.300000f, 197.400000f, 199.500000f, 201.600000f, 203.700000f, 205.800000f, 207.900000f,
+    210.000000f, 212.100000f, 214.200000f, 216.300000f, 218.400000f, 220.500000f, 222.600000f, 224.700000f,
+    226.800000f, 228.900000f, 231.000000f, 233.100000f, 235.200000f, 237.300000f, 239.400000f, 241.500000f,
+    243.600000f, 245.700000f, 247.800000f, 249.900000f, 252.000000f, 254.100000f, 256.200000f, 258.300000f,
+    260.400000f, 262.500000f, 264.600000f, 266.700000f, 268.800000f, 270.900000f, 273.000000f, 275.100000f,
+    277.200000f, 279.300000f, 281.400000f, 283.500000f, 285.600000f, 287.700000f, 289.800000f, 291.900000f,
+    0.000000f, 2.200000f, 4.400000f, 6.600000f, 8.800000f, 11.000000f, 13.200000f, 15.400000f,
+    17.600000f, 19.800000f, 22.000000f, 24.200000f, 26.400000f, 28.600000f, 30.800000f, 33.000000f,
+    35.200000f, 37.400000f, 39.600000f, 41.800000f, 44.000000f, 46.200000f, 48.400000f, 50.600000f,
+    52.800000f, 55.000000f, 57.200000f, 59.400000f, 61.600000f, 63.800000f, 66.000000f, 68.200000f,
+    70.400000f, 72.600000f, 74.800000f, 77.000000f, 79.200000f, 81.400000f, 83.600000f, 85.800000f,
+    88.000000f, 90.200000f, 92.400000f, 94.600000f, 96.800000f, 99.000000f, 101.200000f, 103.400000f,
+    105.600000f, 107.800000f, 110.000000f, 112.200000f, 114.400000f, 116.600000f, 118.800000f, 121.000000f,
+    123.200000f, 125.400000f, 127.600000f, 129.800000f, 132.000000f, 134.200000f, 136.400000f, 138.600000f,
+    140.800000f, 143.000000f, 145.200000f, 147.400000f, 149.600000f, 151.800000f, 154.000000f, 156.200000f,
+    158.400000f, 160.600000f, 162.800000f, 165.000000f, 167.200000f, 169.400000f, 171.600000f, 173.800000f,
+    176.000000f, 178.200000f, 180.400000f, 182.600000f, 184.800000f, 187.000000f, 189.200000f, 191.400000f,
+    193.600000f, 195.800000f, 198.000000f, 200.200000f, 202.400000f, 204.600000f, 206.800000f, 209.000000f,
+    211.200000f, 213.400000f, 215.600000f, 217.800000f, 220.000000f, 222.200000f, 224.400000f, 226.600000f,
+    228.800000f, 231.000000f, 233.200000f, 235.400000f, 237.600000f, 239.800000f, 242.000000f, 244.200000f,
+    246.400000f, 248.600000f, 250.800000f, 253.000000f, 255.200000f, 257.400000f, 259.600000f, 261.800000f,
+    264.000000f, 266.200000f, 268.400000f, 270.600000f, 272.800000f, 275.000000f, 277.200000f, 279.400000f,
+    281.600000f, 283.800000f, 286.000000f, 288.200000f, 290.400000f, 292.600000f, 294.800000f, 297.000000f,
+    299.200000f, 301.400000f, 303.600000f, 305.800000f, 0.000000f, 2.300000f, 4.600000f, 6.900000f,
+    9.200000f, 11.500000f, 13.800000f, 16.100000f, 18.400000f, 20.700000f, 23.000000f, 25.300000f,
+    27.600000f, 29.900000f, 32.200000f, 34.500000f, 36.800000f, 39.100000f, 41.400000f, 43.700000f,
+    46.000000f, 48.300000f, 50.600000f, 52.900000f, 55.200000f, 57.500000f, 59.800000f, 62.100000f,
+    64.400000f, 66.700000f, 69.000000f, 71.300000f, 73.600000f, 75.900000f, 78.200000f, 80.500000f,
+    82.800000f, 85.100000f, 87.400000f, 89.700000f, 92.000000f, 94.300000f, 96.600000f, 98.900000f,
+    101.200000f, 103.500000f, 105.800000f, 108.100000f, 110.400000f, 112.700000f, 115.000000f, 117.300000f,
+    119.600000f, 121.900000f, 124.200000f, 126.500000f, 128.800000f, 131.100000f, 133.400000f, 135.700000f,
+    138.000000f, 140.300000f, 142.600000f, 144.900000f, 147.200000f, 149.500000f, 151.800000f, 154.100000f,
+    156.400000f, 158.700000f, 161.000000f, 163.300000f, 165.600000f, 167.900000f, 170.200000f, 172.500000f,
+    174.800000f, 177.100000f, 179.400000f, 181.700000f, 184.000000f, 186.300000f, 188.600000f, 190.900000f,
+    193.200000f, 195.500000f, 197.800000f, 200.100000f, 202.400000f, 204.700000f, 207.000000f, 209.300000f,
+    211.600000f, 213.900000f, 216.200000f, 218.500000f, 220.800000f, 223.100000f, 225.400000f, 227.700000f,
+    230.000000f, 232.300000f, 234.600000f, 236.900000f, 239.200000f, 241.500000f, 243.800000f, 246.100000f,
+    248.400000f, 250.700000f, 253.000000f, 255.300000f, 257.600000f, 259.900000f, 262.200000f, 264.500000f,
+    266.800000f, 269.100000f, 271.400000f, 273.700000f, 276.000000f, 278.300000f, 280.600000f, 282.900000f,
+    285.200000f, 287.500000f, 289.800000f, 292.100000f, 294.400000f, 296.700000f, 299.000000f, 301.300000f,
+    303.600000f, 305.900000f, 308.200000f, 310.500000f, 312.800000f, 315.100000f, 317.400000f, 319.700000f,
+    0.000000f, 2.400000f, 4.800000f, 7.200000f, 9.600000f, 12.000000f, 14.400000f, 16.800000f,
+    19.200000f, 21.600000f, 24.000000f, 26.400000f, 28.800000f, 31.200000f, 33.600000f, 36.000000f,
+    38.400000f, 40.800000f, 43.200000f, 45.600000f, 48.000000f, 50.400000f, 52.800000f, 55.200000f,
+    57.600000f, 60.000000f, 62.400000f, 64.800000f, 67.200000f, 69.600000f, 72.000000f, 74.400000f,
+    76.800000f, 79.200000f, 81.600000f, 84.000000f, 86.400000f, 88.800000f, 91.200000f, 93.600000f,
+    96.000000f, 98.400000f, 100.800000f, 103.200000f, 105.600000f, 108.000000f, 110.400000f, 112.800000f,
+    115.200000f, 117.600000f, 120.000000f, 122.400000f, 124.800000f, 127.200000f, 129.600000f, 132.000000f,
+    134.400000f, 136.800000f, 139.200000f, 141.600000f, 144.000000f, 146.400000f, 148.800000f, 151.200000f,
+    153.600000f, 156.000000f, 158.400000f, 160.800000f, 163.200000f, 165.600000f, 168.000000f, 170.400000f,
+    172.800000f, 175.200000f, 177.600000f, 180.000000f, 182.400000f, 184.800000f, 187.200000f, 189.600000f,
+    192.000000f, 194.400000f, 196.800000f, 199.200000f, 201.600000f, 204.000000f, 206.400000f, 208.800000f,
+    211.200000f, 213.600000f, 216.000000f, 218.400000f, 220.800000f, 223.200000f, 225.600000f, 228.000000f,
+    230.400000f, 232.800000f, 235.200000f, 237.600000f, 240.000000f, 242.400000f, 244.800000f, 247.200000f,
+    249.600000f, 252.000000f, 254.400000f, 256.800000f, 259.200000f, 261.600000f, 264.000000f, 266.400000f,
+    268.800000f, 271.200000f, 273.600000f, 276.000000f, 278.400000f, 280.800000f, 283.200000f, 285.600000f,
+    288.000000f, 290.400000f, 292.800000f, 295.200000f, 297.600000f, 300.000000f, 302.400000f, 304.800000f,
+    307.200000f, 309.600000f, 312.000000f, 314.400000f, 316.800000f, 319.200000f, 321.600000f, 324.000000f,
+    326.400000f, 328.800000f, 331.200000f, 333.600000f, 0.000000f, 2.500000f, 5.000000f, 7.500000f,
+    10.000000f, 12.500000f, 15.000000f, 17.500000f, 20.000000f, 22.500000f, 25.000000f, 27.500000f,
+    30.000000f, 32.500000f, 35.000000f, 37.500000f, 40.000000f, 42.500000f, 45.000000f, 47.500000f,
+    50.000000f, 52.500000f, 55.000000f, 57.500000f, 60.000000f, 62.500000f, 65.000000f, 67.500000f,
+    70.000000f, 72.500000f, 75.000000f, 77.500000f, 80.000000f, 82.500000f, 85.000000f, 87.500000f,
+    90.000000f, 92.500000f, 95.000000f, 97.500000f, 100.000000f, 102.500000f, 105.000000f, 107.500000f,
+    110.000000f, 112.500000f, 115.000000f, 117.500000f, 120.000000f, 122.500000f, 125.000000f, 127.500000f,
+    130.000000f, 132.500000f, 135.000000f, 137.500000f, 140.000000f, 142.500000f, 145.000000f, 147.500000f,
+    150.000000f, 152.500000f, 155.000000f, 157.500000f, 160.000000f, 162.500000f, 165.000000f, 167.500000f,
+    170.000000f, 172.500000f, 175.000000f, 177.500000f, 180.000000f, 182.500000f, 185.000000f, 187.500000f,
+    190.000000f, 192.500000f, 195.000000f, 197.500000f, 200.000000f, 202.500000f, 205.000000f, 207.500000f,
+    210.000000f, 212.500000f, 215.000000f, 217.500000f, 220.000000f, 222.500000f, 225.000000f, 227.500000f,
+    230.000000f, 232.500000f, 235.000000f, 237.500000f, 240.000000f, 242.500000f, 245.000000f, 247.500000f,
+    250.000000f, 252.500000f, 255.000000f, 257.500000f, 260.000000f, 262.500000f, 265.000000f, 267.500000f,
+    270.000000f, 272.500000f, 275.000000f, 277.500000f, 280.000000f, 282.500000f, 285.000000f, 287.500000f,
+    290.000000f, 292.500000f, 295.000000f, 297.500000f, 300.000000f, 302.500000f, 305.000000f, 307.500000f,
+    310.000000f, 312.500000f, 315.000000f, 317.500000f, 320.000000f, 322.500000f, 325.000000f, 327.500000f,
+    330.000000f, 332.500000f, 335.000000f, 337.500000f, 340.000000f, 342.500000f, 345.000000f, 347.500000f,
+    0.000000f, 2.600000f, 5.200000f, 7.800000f, 10.400000f, 13.000000f, 15.600000f, 18.200000f,
+    20.800000f, 23.400000f, 26.000000f, 28.600000f, 31.200000f, 33.800000f, 36.400000f, 39.000000f,
+    41.600000f, 44.200000f, 46.800000f, 49.400000f, 52.000000f, 54.600000f, 57.200000f, 59.800000f,
+    62.400000f, 65.000000f, 67.600000f, 70.200000f, 72.800000f, 75.400000f, 78.000000f, 80.600000f,
+    83.200000f, 85.800000f, 88.400000f, 91.000000f, 93.600000f, 96.200000f, 98.800000f, 101.400000f,
+    104.000000f, 106.600000f, 109.200000f, 111.800000f, 114.400000f, 117.000000f, 119.600000f, 122.200000f,
+    124.800000f, 127.400000f, 130.000000f, 132.600000f, 135.200000f, 137.800000f, 140.400000f, 143.000000f,
+    145.600000f, 148.200000f, 150.800000f, 153.400000f, 156.000000f, 158.600000f, 161.200000f, 163.800000f,
+    166.400000f, 169.000000f, 171.600000f, 174.200000f, 176.800000f, 179.400000f, 182.000000f, 184.600000f,
+    187.200000f, 189.800000f, 192.400000f, 195.000000f, 197.600000f, 200.200000f, 202.800000f, 205.400000f,
+    208.000000f, 210.600000f, 213.200000f, 215.800000f, 218.400000f, 221.000000f, 223.600000f, 226.200000f,
+    228.800000f, 231.400000f, 234.000000f, 236.600000f, 239.200000f, 241.800000f, 244.400000f, 247.000000f,
+    249.600000f, 252.200000f, 254.800000f, 257.400000f, 260.000000f, 262.600000f, 265.200000f, 267.800000f,
+    270.400000f, 273.000000f, 275.600000f, 278.200000f, 280.800000f, 283.400000f, 286.000000f, 288.600000f,
+    291.200000f, 293.800000f, 296.400000f, 299.000000f, 301.600000f, 304.200000f, 306.800000f, 309.400000f,
+    312.000000f, 314.600000f, 317.200000f, 319.800000f, 322.400000f, 325.000000f, 327.600000f, 330.200000f,
+    332.800000f, 335.400000f, 338.000000f, 340.600000f, 343.200000f, 345.800000f, 348.400000f, 351.000000f,
+    353.600000f, 356.200000f, 358.800000f, 361.400000f, 0.000000f, 2.700000f, 5.400000f, 8.100000f,
+    10.800000f, 13.500000f, 16.200000f, 18.900000f, 21.600000f, 24.300000f, 27.000000f, 29.700000f,
+    32.400000f, 35.100000f, 37.800000f, 40.500000f, 43.200000f, 45.900000f, 48.600000f, 51.300000f,
+    54.000000f, 56.700000f, 59.400000f, 62.100000f, 64.800000f, 67.500000f, 70.200000f, 72.900000f,
+    75.600000f, 78.300000f, 81.000000f, 83.700000f, 86.400000f, 89.100000f, 91.800000f, 94.500000f,
+    97.200000f, 99.900000f, 102.600000f, 105.300000f, 108.000000f, 110.700000f, 113.400000f, 116.100000f,
+    118.800000f, 121.500000f, 124.200000f, 126.900000f, 129.600000f, 132.300000f, 135.000000f, 137.700000f,
+    140.400000f, 143.100000f, 145.800000f, 148.500000f, 151.200000f, 153.900000f, 156.600000f, 159.300000f,
+    162.000000f, 164.700000f, 167.400000f, 170.100000f, 172.800000f, 175.500000f, 178.200000f, 180.900000f,
+    183.600000f, 186.300000f, 189.000000f, 191.700000f, 194.400000f, 197.100000f, 199.800000f, 202.500000f,
+    205.200000f, 207.900000f, 210.600000f, 213.300000f, 216.000000f, 218.700000f, 221.400000f, 224.100000f,
+    226.800000f, 229.500000f, 232.200000f, 234.900000f, 237.600000f, 240.300000f, 243.000000f, 245.700000f,
+    248.400000f, 251.100000f, 253.800000f, 256.500000f, 259.200000f, 261.900000f, 264.600000f, 267.300000f,
+    270.000000f, 272.700000f, 275.400000f, 278.100000f, 280.800000f, 283.500000f, 286.200000f, 288.900000f,
+    291.600000f, 294.300000f, 297.000000f, 299.700000f, 302.400000f, 305.100000f, 307.800000f, 310.500000f,
+    313.200000f, 315.900000f, 318.600000f, 321.300000f, 324.000000f, 326.700000f, 329.400000f, 332.100000f,
+    334.800000f, 337.500000f, 340.200000f, 342.900000f, 345.600000f, 348.300000f, 351.000000f, 353.700000f,
+    356.400000f, 359.100000f, 361.800000f, 364.500000f, 367.200000f, 369.900000f, 372.600000f, 375.300000f,
+    0.000000f, 2.800000f, 5.600000f, 8.400000f, 11.200000f, 14.000000f, 16.800000f, 19.600000f,
+    22.400000f, 25.200000f, 28.000000f, 30.800000f, 33.600000f, 36.400000f, 39.200000f, 42.000000f,
+    44.800000f, 47.600000f, 50.400000f, 53.200000f, 56.000000f, 58.800000f, 61.600000f, 64.400000f,
+    67.200000f, 70.000000f, 72.800000f, 75.600000f, 78.400000f, 81.200000f, 84.000000f, 86.800000f,
+    89.600000f, 92.400000f, 95.200000f, 98.000000f, 100.800000f, 103.600000f, 106.400000f, 109.200000f,
+    112.000000f, 114.800000f, 117.600000f, 120.400000f, 123.200000f, 126.000000f, 128.800000f, 131.600000f,
+    134.400000f, 137.200000f, 140.000000f, 142.800000f, 145.600000f, 148.400000f, 151.200000f, 154.000000f,
+    156.800000f, 159.600000f, 162.400000f, 165.200000f, 168.000000f, 170.800000f, 173.600000f, 176.400000f,
+    179.200000f, 182.000000f, 184.800000f, 187.600000f, 190.400000f, 193.200000f, 196.000000f, 198.800000f,
+    201.600000f, 204.400000f, 207.200000f, 210.000000f, 212.800000f, 215.600000f, 218.400000f, 221.200000f,
+    224.000000f, 226.800000f, 229.600000f, 232.400000f, 235.200000f, 238.000000f, 240.800000f, 243.600000f,
+    246.400000f, 249.200000f, 252.000000f, 254.800000f, 257.600000f, 260.400000f, 263.200000f, 266.000000f,
+    268.800000f, 271.600000f, 274.400000f, 277.200000f, 280.000000f, 282.800000f, 285.600000f, 288.400000f,
+    291.200000f, 294.000000f, 296.800000f, 299.600000f, 302.400000f, 305.200000f, 308.000000f, 310.800000f,
+    313.600000f, 316.400000f, 319.200000f, 322.000000f, 324.800000f, 327.600000f, 330.400000f, 333.200000f,
+    336.000000f, 338.800000f, 341.600000f, 344.400000f, 347.200000f, 350.000000f, 352.800000f, 355.600000f,
+    358.400000f, 361.200000f, 364.000000f, 366.800000f, 369.600000f, 372.400000f, 375.200000f, 378.000000f,
+    380.800000f, 383.600000f, 386.400000f, 389.200000f, 0.000000f, 2.900000f, 5.800000f, 8.700000f,
+    11.600000f, 14.500000f, 17.400000f, 20.300000f, 23.200000f, 26.100000f, 29.000000f, 31.900000f,
+    34.800000f, 37.700000f, 40.600000f, 43.500000f, 46.400000f, 49.300000f, 52.200000f, 55.100000f,
+    58.000000f, 60.900000f, 63.800000f, 66.700000f, 69.600000f, 72.500000f, 75.400000f, 78.300000f,
+    81.200000f, 84.100000f, 87.000000f, 89.900000f, 92.800000f, 95.700000f, 98.600000f, 101.500000f,
+    104.400000f, 107.300000f, 110.200000f, 113.100000f, 116.000000f, 118.900000f, 121.800000f, 124.700000f,
+    127.600000f, 130.500000f, 133.400000f, 136.300000f, 139.200000f, 142.100000f, 145.000000f, 147.900000f,
+    150.800000f, 153.700000f, 156.600000f, 159.500000f, 162.400000f, 165.300000f, 168.200000f, 171.100000f,
+    174.000000f, 176.900000f, 179.800000f, 182.700000f, 185.600000f, 188.500000f, 191.400000f, 194.300000f,
+    197.200000f, 200.100000f, 203.000000f, 205.900000f, 208.800000f, 211.700000f, 214.600000f, 217.500000f,
+    220.400000f, 223.300000f, 226.200000f, 229.100000f, 232.000000f, 234.900000f, 237.800000f, 240.700000f,
+    243.600000f, 246.500000f, 249.400000f, 252.300000f, 255.200000f, 258.100000f, 261.000000f, 263.900000f,
+    266.800000f, 269.700000f, 272.600000f, 275.500000f, 278.400000f, 281.300000f, 284.200000f, 287.100000f,
+    290.000000f, 292.900000f, 295.800000f, 298.700000f, 301.600000f, 304.500000f, 307.400000f, 310.300000f,
+    313.200000f, 316.100000f, 319.000000f, 321.900000f, 324.800000f, 327.700000f, 330.600000f, 333.500000f,
+    336.400000f, 339.300000f, 342.200000f, 345.100000f, 348.000000f, 350.900000f, 353.800000f, 356.700000f,
+    359.600000f, 362.500000f, 365.400000f, 368.300000f, 371.200000f, 374.100000f, 377.000000f, 379.900000f,
+    382.800000f, 385.700000f, 388.600000f, 391.500000f, 394.400000f, 397.300000f, 400.200000f, 403.100000f,
+    0.000000f, 3.000000f, 6.000000f, 9.000000f, 12.000000f, 15.000000f, 18.000000f, 21.000000f,
+    24.000000f, 27.000000f, 30.000000f, 33.000000f, 36.000000f, 39.000000f, 42.000000f, 45.000000f,
+    48.000000f, 51.000000f, 54.000000f, 57.000000f, 60.000000f, 63.000000f, 66.000000f, 69.000000f,
+    72.000000f, 75.000000f, 78.000000f, 81.000000f, 84.000000f, 87.000000f, 90.000000f, 93.000000f,
+    96.000000f, 99.000000f, 102.000000f, 105.000000f, 108.000000f, 111.000000f, 114.000000f, 117.000000f,
+    120.000000f, 123.000000f, 126.000000f, 129.000000f, 132.000000f, 135.000000f, 138.000000f, 141.000000f,
+    144.000000f, 147.000000f, 150.000000f, 153.000000f, 156.000000f, 159.000000f, 162.000000f, 165.000000f,
+    168.000000f, 171.000000f, 174.000000f, 177.000000f, 180.000000f, 183.000000f, 186.000000f, 189.000000f,
+    192.000000f, 195.000000f, 198.000000f, 201.000000f, 204.000000f, 207.000000f, 210.000000f, 213.000000f,
+    216.000000f, 219.000000f, 222.000000f, 225.000000f, 228.000000f, 231.000000f, 234.000000f, 237.000000f,
+    240.000000f, 243.000000f, 246.000000f, 249.000000f, 252.000000f, 255.000000f, 258.000000f, 261.000000f,
+    264.000000f, 267.000000f, 270.000000f, 273.000000f, 276.000000f, 279.000000f, 282.000000f, 285.000000f,
+    288.000000f, 291.000000f, 294.000000f, 297.000000f, 300.000000f, 303.000000f, 306.000000f, 309.000000f,
+    312.000000f, 315.000000f, 318.000000f, 321.000000f, 324.000000f, 327.000000f, 330.000000f, 333.000000f,
+    336.000000f, 339.000000f, 342.000000f, 345.000000f, 348.000000f, 351.000000f, 354.000000f, 357.000000f,
+    360.000000f, 363.000000f, 366.000000f, 369.000000f, 372.000000f, 375.000000f, 378.000000f, 381.000000f,
+    384.000000f, 387.000000f, 390.000000f, 393.000000f, 396.000000f, 399.000000f, 402.000000f, 405.000000f,
+    408.000000f, 411.000000f, 414.000000f, 417.000000f, 0.000000f, 3.100000f, 6.200000f, 9.300000f,
+    12.400000f, 15.500000f, 18.600000f, 21.700000f, 24.800000f, 27.900000f, 31.000000f, 34.100000f,
+    37.200000f, 40.300000f, 43.400000f, 46.500000f, 49.600000f, 52.700000f, 55.800000f, 58.900000f,
+    62.000000f, 65.100000f, 68.200000f, 71.300000f, 74.400000f, 77.500000f, 80.600000f, 83.700000f,
+    86.800000f, 89.900000f, 93.000000f, 96.100000f, 99.200000f, 102.300000f, 105.400000f, 108.500000f,
+    111.600000f, 114.700000f, 117.800000f, 120.900000f, 124.000000f, 127.100000f, 130.200000f, 133.300000f,
+    136.400000f, 139.500000f, 142.600000f, 145.700000f, 148.800000f, 151.900000f, 155.000000f, 158.100000f,
+    161.200000f, 164.300000f, 167.400000f, 170.500000f, 173.600000f, 176.700000f, 179.800000f, 182.900000f,
+    186.000000f, 189.100000f, 192.200000f, 195.300000f, 198.400000f, 201.500000f, 204.600000f, 207.700000f,
+    210.800000f, 213.900000f, 217.000000f, 220.100000f, 223.200000f, 226.300000f, 229.400000f, 232.500000f,
+    235.600000f, 238.700000f, 241.800000f, 244.900000f, 248.000000f, 251.100000f, 254.200000f, 257.300000f,
+    260.400000f, 263.500000f, 266.600000f, 269.700000f, 272.800000f, 275.900000f, 279.000000f, 282.100000f,
+    285.200000f, 288.300000f, 291.400000f, 294.500000f, 297.600000f, 300.700000f, 303.800000f, 306.900000f,
+    310.000000f, 313.100000f, 316.200000f, 319.300000f, 322.400000f, 325.500000f, 328.600000f, 331.700000f,
+    334.800000f, 337.900000f, 341.000000f, 344.100000f, 347.200000f, 350.300000f, 353.400000f, 356.500000f,
+    359.600000f, 362.700000f, 365.800000f, 368.900000f, 372.000000f, 375.100000f, 378.200000f, 381.300000f,
+    384.400000f, 387.500000f, 390.600000f, 393.700000f, 396.800000f, 399.900000f, 403.000000f, 406.100000f,
+    409.200000f, 412.300000f, 415.400000f, 418.500000f, 421.600000f, 424.700000f, 427.800000f, 430.900000f,
+    0.000000f, 3.200000f, 6.400000f, 9.600000f, 12.800000f, 16.000000f, 19.200000f, 22.400000f,
+    25.600000f, 28.800000f, 32.000000f, 35.200000f, 38.400000f, 41.600000f, 44.800000f, 48.000000f,
+    51.200000f, 54.400000f, 57.600000f, 60.800000f, 64.000000f, 67.200000f, 70.400000f, 73.600000f,
+    76.800000f, 80.000000f, 83.200000f, 86.400000f, 89.600000f, 92.800000f, 96.000000f, 99.200000f,
+    102.400000f, 105.600000f, 108.800000f, 112.000000f, 115.200000f, 118.400000f, 121.600000f, 124.800000f,
+    128.000000f, 131.200000f, 134.400000f, 137.600000f, 140.800000f, 144.000000f, 147.200000f, 150.400000f,
+    153.600000f, 156.800000f, 160.000000f, 163.200000f, 166.400000f, 169.600000f, 172.800000f, 176.000000f,
+    179.200000f, 182.400000f, 185.600000f, 188.800000f, 192.000000f, 195.200000f, 198.400000f, 201.600000f,
+    204.800000f, 208.000000f, 211.200000f, 214.400000f, 217.600000f, 220.800000f, 224.000000f, 227.200000f,
+    230.400000f, 233.600000f, 236.800000f, 240.000000f, 243.200000f, 246.400000f, 249.600000f, 252.800000f,
+    256.000000f, 259.200000f, 262.400000f, 265.600000f, 268.800000f, 272.000000f, 275.200000f, 278.400000f,
+    281.600000f, 284.800000f, 288.000000f, 291.200000f, 294.400000f, 297.600000f, 300.800000f, 304.000000f,
+    307.200000f, 310.400000f, 313.600000f, 316.800000f, 320.000000f, 323.200000f, 326.400000f, 329.600000f,
+    332.800000f, 336.000000f, 339.200000f, 342.400000f, 345.600000f, 348.800000f, 352.000000f, 355.200000f,
+    358.400000f, 361.600000f, 364.800000f, 368.000000f, 371.200000f, 374.400000f, 377.600000f, 380.800000f,
+    384.000000f, 387.200000f, 390.400000f, 393.600000f, 396.800000f, 400.000000f, 403.200000f, 406.400000f,
+    409.600000f, 412.800000f, 416.000000f, 419.200000f, 422.400000f, 425.600000f, 428.800000f, 432.000000f,
+    435.200000f, 438.400000f, 441.600000f, 444.800000f, 0.000000f, 3.300000f, 6.600000f, 9.900000f,
+    13.200000f, 16.500000f, 19.800000f, 23.100000f, 26.400000f, 29.700000f, 33.000000f, 36.300000f,
+    39.600000f, 42.900000f, 46.200000f, 49.500000f, 52.800000f, 56.100000f, 59.400000f, 62.700000f,
+    66.000000f, 69.300000f, 72.600000f, 75.900000f, 79.200000f, 82.500000f, 85.800000f, 89.100000f,
+    92.400000f, 95.700000f, 99.000000f, 102.300000f, 105.600000f, 108.900000f, 112.200000f, 115.500000f,
+    118.800000f, 122.100000f, 125.400000f, 128.700000f, 132.000000f, 135.300000f, 138.600000f, 141.900000f,
+    145.200000f, 148.500000f, 151.800000f, 155.100000f, 158.400000f, 161.700000f, 165.000000f, 168.300000f,
+    171.600000f, 174.900000f, 178.200000f, 181.500000f, 184.800000f, 188.100000f, 191.400000f, 194.700000f,
+    198.000000f, 201.300000f, 204.600000f, 207.900000f, 211.200000f, 214.500000f, 217.800000f, 221.100000f,
+    224.400000f, 227.700000f, 231.000000f, 234.300000f, 237.600000f, 240.900000f, 244.200000f, 247.500000f,
+    250.800000f, 254.100000f, 257.400000f, 260.700000f, 264.000000f, 267.300000f, 270.600000f, 273.900000f,
+    277.200000f, 280.500000f, 283.800000f, 287.100000f, 290.400000f, 293.700000f, 297.000000f, 300.300000f,
+    303.600000f, 306.900000f, 310.200000f, 313.500000f, 316.800000f, 320.100000f, 323.400000f, 326.700000f,
+    330.000000f, 333.300000f, 336.600000f, 339.900000f, 343.200000f, 346.500000f, 349.800000f, 353.100000f,
+    356.400000f, 359.700000f, 363.000000f, 366.300000f, 369.600000f, 372.900000f, 376.200000f, 379.500000f,
+    382.800000f, 386.100000f, 389.400000f, 392.700000f, 396.000000f, 399.300000f, 402.600000f, 405.900000f,
+    409.200000f, 412.500000f, 415.800000f, 419.100000f, 422.400000f, 425.700000f, 429.000000f, 432.300000f,
+    435.600000f, 438.900000f, 442.200000f, 445.500000f, 448.800000f, 452.100000f, 455.400000f, 458.700000f,
+    0.000000f, 3.400000f, 6.800000f, 10.200000f, 13.600000f, 17.000000f, 20.400000f, 23.800000f,
+    27.200000f, 30.600000f, 34.000000f, 37.400000f, 40.800000f, 44.200000f, 47.600000f, 51.000000f,
+    54.400000f, 57.800000f, 61.200000f, 64.600000f, 68.000000f, 71.400000f, 74.800000f, 78.200000f,
+    81.600000f, 85.000000f, 88.400000f, 91.800000f, 95.200000f, 98.600000f, 102.000000f, 105.400000f,
+    108.800000f, 112.200000f, 115.600000f, 119.000000f, 122.400000f, 125.800000f, 129.200000f, 132.600000f,
+    136.000000f, 139.400000f, 142.800000f, 146.200000f, 149.600000f, 153.000000f, 156.400000f, 159.800000f,
+    163.200000f, 166.600000f, 170.000000f, 173.400000f, 176.800000f, 180.200000f, 183.600000f, 187.000000f,
+    190.400000f, 193.800000f, 197.200000f, 200.600000f, 204.000000f, 207.400000f, 210.800000f, 214.200000f,
+    217.600000f, 221.000000f, 224.400000f, 227.800000f, 231.200000f, 234.600000f, 238.000000f, 241.400000f,
+    244.800000f, 248.200000f, 251.600000f, 255.000000f, 258.400000f, 261.800000f, 265.200000f, 268.600000f,
+    272.000000f, 275.400000f, 278.800000f, 282.200000f, 285.600000f, 289.000000f, 292.400000f, 295.800000f,
+    299.200000f, 302.600000f, 306.000000f, 309.400000f, 312.800000f, 316.200000f, 319.600000f, 323.000000f,
+    326.400000f, 329.800000f, 333.200000f, 336.600000f, 340.000000f, 343.400000f, 346.800000f, 350.200000f,
+    353.600000f, 357.000000f, 360.400000f, 363.800000f, 367.200000f, 370.600000f, 374.000000f, 377.400000f,
+    380.800000f, 384.200000f, 387.600000f, 391.000000f, 394.400000f, 397.800000f, 401.200000f, 404.600000f,
+    408.000000f, 411.400000f, 414.800000f, 418.200000f, 421.600000f, 425.000000f, 428.400000f, 431.800000f,
+    435.200000f, 438.600000f, 442.000000f, 445.400000f, 448.800000f, 452.200000f, 455.600000f, 459.000000f,
+    462.400000f, 465.800000f, 469.200000f, 472.600000f, 0.000000f, 3.500000f, 7.000000f, 10.500000f,
+    14.000000f, 17.500000f, 21.000000f, 24.500000f, 28.000000f, 31.500000f, 35.000000f, 38.500000f,
+    42.000000f, 45.500000f, 49.000000f, 52.500000f, 56.000000f, 59.500000f, 63.000000f, 66.500000f,
+    70.000000f, 73.500000f, 77.000000f, 80.500000f, 84.000000f, 87.500000f, 91.000000f, 94.500000f,
+    98.000000f, 101.500000f, 105.000000f, 108.500000f, 112.000000f, 115.500000f, 119.000000f, 122.500000f,
+    126.000000f, 129.500000f, 133.000000f, 136.500000f, 140.000000f, 143.500000f, 147.000000f, 150.500000f,
+    154.000000f, 157.500000f, 161.000000f, 164.500000f, 168.000000f, 171.500000f, 175.000000f, 178.500000f,
+    182.000000f, 185.500000f, 189.000000f, 192.500000f, 196.000000f, 199.500000f, 203.000000f, 206.500000f,
+    210.000000f, 213.500000f, 217.000000f, 220.500000f, 224.000000f, 227.500000f, 231.000000f, 234.500000f,
+    238.000000f, 241.500000f, 245.000000f, 248.500000f, 252.000000f, 255.500000f, 259.000000f, 262.500000f,
+    266.000000f, 269.500000f, 273.000000f, 276.500000f, 280.000000f, 283.500000f, 287.000000f, 290.500000f,
+    294.000000f, 297.500000f, 301.000000f, 304.500000f, 308.000000f, 311.500000f, 315.000000f, 318.500000f,
+    322.000000f, 325.500000f, 329.000000f, 332.500000f, 336.000000f, 339.500000f, 343.000000f, 346.500000f,
+    350.000000f, 353.500000f, 357.000000f, 360.500000f, 364.000000f, 367.500000f, 371.000000f, 374.500000f,
+    378.000000f, 381.500000f, 385.000000f, 388.500000f, 392.000000f, 395.500000f, 399.000000f, 402.500000f,
+    406.000000f, 409.500000f, 413.000000f, 416.500000f, 420.000000f, 423.500000f, 427.000000f, 430.500000f,
+    434.000000f, 437.500000f, 441.000000f, 444.500000f, 448.000000f, 451.500000f, 455.000000f, 458.500000f,
+    462.000000f, 465.500000f, 469.000000f, 472.500000f, 476.000000f, 479.500000f, 483.000000f, 486.500000f,
+    0.000000f, 3.600000f, 7.200000f, 10.800000f, 14.400000f, 18.000000f, 21.600000f, 25.200000f,
+    28.800000f, 32.400000f, 36.000000f, 39.600000f, 43.200000f, 46.800000f, 50.400000f, 54.000000f,
+    57.600000f, 61.200000f, 64.800000f, 68.400000f, 72.000000f, 75.600000f, 79.200000f, 82.800000f,
+    86.400000f, 90.000000f, 93.600000f, 97.200000f, 100.800000f, 104.400000f, 108.000000f, 111.600000f,
+    115.200000f, 118.800000f, 122.400000f, 126.000000f, 129.600000f, 133.200000f, 136.800000f, 140.400000f,
+    144.000000f, 147.600000f, 151.200000f, 154.800000f, 158.400000f, 162.000000f, 165.600000f, 169.200000f,
+    172.800000f, 176.400000f, 180.000000f, 183.600000f, 187.200000f, 190.800000f, 194.400000f, 198.000000f,
+    201.600000f, 205.200000f, 208.800000f, 212.400000f, 216.000000f, 219.600000f, 223.200000f, 226.800000f,
+    230.400000f, 234.000000f, 237.600000f, 241.200000f, 244.800000f, 248.400000f, 252.000000f, 255.600000f,
+    259.200000f, 262.800000f, 266.400000f, 270.000000f, 273.600000f, 277.200000f, 280.800000f, 284.400000f,
+    288.000000f, 291.600000f, 295.200000f, 298.800000f, 302.400000f, 306.000000f, 309.600000f, 313.200000f,
+    316.800000f, 320.400000f, 324.000000f, 327.600000f, 331.200000f, 334.800000f, 338.400000f, 342.000000f,
+    345.600000f, 349.200000f, 352.800000f, 356.400000f, 360.000000f, 363.600000f, 367.200000f, 370.800000f,
+    374.400000f, 378.000000f, 381.600000f, 385.200000f, 388.800000f, 392.400000f, 396.000000f, 399.600000f,
+    403.200000f, 406.800000f, 410.400000f, 414.000000f, 417.600000f, 421.200000f, 424.800000f, 428.400000f,
+    432.000000f, 435.600000f, 439.200000f, 442.800000f, 446.400000f, 450.000000f, 453.600000f, 457.200000f,
+    460.800000f, 464.400000f, 468.000000f, 471.600000f, 475.200000f, 478.800000f, 482.400000f, 486.000000f,
+    489.600000f, 493.200000f, 496.800000f, 500.400000f, 0.000000f, 3.700000f, 7.400000f, 11.100000f,
+    14.800000f, 18.500000f, 22.200000f, 25.900000f, 29.600000f, 33.300000f, 37.000000f, 40.700000f,
+    44.400000f, 48.100000f, 51.800000f, 55.500000f, 59.200000f, 62.900000f, 66.600000f, 70.300000f,
+    74.000000f, 77.700000f, 81.400000f, 85.100000f, 88.800000f, 92.500000f, 96.200000f, 99.900000f,
+    103.600000f, 107.300000f, 111.000000f, 114.700000f, 118.400000f, 122.100000f, 125.800000f, 129.500000f,
+    133.200000f, 136.900000f, 140.600000f, 144.300000f, 148.000000f, 151.700000f, 155.400000f, 159.100000f,
+    162.800000f, 166.500000f, 170.200000f, 173.900000f, 177.600000f, 181.300000f, 185.000000f, 188.700000f,
+    192.400000f, 196.100000f, 199.800000f, 203.500000f, 207.200000f, 210.900000f, 214.600000f, 218.300000f,
+    222.000000f, 225.700000f, 229.400000f, 233.100000f, 236.800000f, 240.500000f, 244.200000f, 247.900000f,
+    251.600000f, 255.300000f, 259.000000f, 262.700000f, 266.400000f, 270.100000f, 273.800000f, 277.500000f,
+    281.200000f, 284.900000f, 288.600000f, 292.300000f, 296.000000f, 299.700000f, 303.400000f, 307.100000f,
+    310.800000f, 314.500000f, 318.200000f, 321.900000f, 325.600000f, 329.300000f, 333.000000f, 336.700000f,
+    340.400000f, 344.100000f, 347.800000f, 351.500000f, 355.200000f, 358.900000f, 362.600000f, 366.300000f,
+    370.000000f, 373.700000f, 377.400000f, 381.100000f, 384.800000f, 388.500000f, 392.200000f, 395.900000f,
+    399.600000f, 403.300000f, 407.000000f, 410.700000f, 414.400000f, 418.100000f, 421.800000f, 425.500000f,
+    429.200000f, 432.900000f, 436.600000f, 440.300000f, 444.000000f, 447.700000f, 451.400000f, 455.100000f,
+    458.800000f, 462.500000f, 466.200000f, 469.900000f, 473.600000f, 477.300000f, 481.000000f, 484.700000f,
+    488.400000f, 492.100000f, 495.800000f, 499.500000f, 503.200000f, 506.900000f, 510.600000f, 514.300000f,
+    0.000000f, 3.800000f, 7.600000f, 11.400000f, 15.200000f, 19.000000f, 22.800000f, 26.600000f,
+    30.400000f, 34.200000f, 38.000000f, 41.800000f, 45.600000f, 49.400000f, 53.200000f, 57.000000f,
+    60.800000f, 64.600000f, 68.400000f, 72.200000f, 76.000000f, 79.800000f, 83.600000f, 87.400000f,
+    91.200000f, 95.000000f, 98.800000f, 102.600000f, 106.400000f, 110.200000f, 114.000000f, 117.800000f,
+    121.600000f, 125.400000f, 129.200000f, 133.000000f, 136.800000f, 140.600000f, 144.400000f, 148.200000f,
+    152.000000f, 155.800000f, 159.600000f, 163.400000f, 167.200000f, 171.000000f, 174.800000f, 178.600000f,
+    182.400000f, 186.200000f, 190.000000f, 193.800000f, 197.600000f, 201.400000f, 205.200000f, 209.000000f,
+    212.800000f, 216.600000f, 220.400000f, 224.200000f, 228.000000f, 231.800000f, 235.600000f, 239.400000f,
+    243.200000f, 247.000000f, 250.800000f, 254.600000f, 258.400000f, 262.200000f, 266.000000f, 269.800000f,
+    273.600000f, 277.400000f, 281.200000f, 285.000000f, 288.800000f, 292.600000f, 296.400000f, 300.200000f,
+    304.000000f, 307.800000f, 311.600000f, 315.400000f, 319.200000f, 323.000000f, 326.800000f, 330.600000f,
+    334.400000f, 338.200000f, 342.000000f, 345.800000f, 349.600000f, 353.400000f, 357.200000f, 361.000000f,
+    364.800000f, 368.600000f, 372.400000f, 376.200000f, 380.000000f, 383.800000f, 387.600000f, 391.400000f,
+    395.200000f, 399.000000f, 402.800000f, 406.600000f, 410.400000f, 414.200000f, 418.000000f, 421.800000f,
+    425.600000f, 429.400000f, 433.200000f, 437.000000f, 440.800000f, 444.600000f, 448.400000f, 452.200000f,
+    456.000000f, 459.800000f, 463.600000f, 467.400000f, 471.200000f, 475.000000f, 478.800000f, 482.600000f,
+    486.400000f, 490.200000f, 494.000000f, 497.800000f, 501.600000f, 505.400000f, 509.200000f, 513.000000f,
+    516.800000f, 520.600000f, 524.400000f, 528.200000f, 0.000000f, 3.900000f, 7.800000f, 11.700000f,
+    15.600000f, 19.500000f, 23.400000f, 27.300000f, 31.200000f, 35.100000f, 39.000000f, 42.900000f,
+    46.800000f, 50.700000f, 54.600000f, 58.500000f, 62.400000f, 66.300000f, 70.200000f, 74.100000f,
+    78.000000f, 81.900000f, 85.800000f, 89.700000f, 93.600000f, 97.500000f, 101.400000f, 105.300000f,
+    109.200000f, 113.100000f, 117.000000f, 120.900000f, 124.800000f, 128.700000f, 132.600000f, 136.500000f,
+    140.400000f, 144.300000f, 148.200000f, 152.100000f, 156.000000f, 159.900000f, 163.800000f, 167.700000f,
+    171.600000f, 175.500000f, 179.400000f, 183.300000f, 187.200000f, 191.100000f, 195.000000f, 198.900000f,
+    202.800000f, 206.700000f, 210.600000f, 214.500000f, 218.400000f, 222.300000f, 226.200000f, 230.100000f,
+    234.000000f, 237.900000f, 241.800000f, 245.700000f, 249.600000f, 253.500000f, 257.400000f, 261.300000f,
+    265.200000f, 269.100000f, 273.000000f, 276.900000f, 280.800000f, 284.700000f, 288.600000f, 292.500000f,
+    296.400000f, 300.300000f, 304.200000f, 308.100000f, 312.000000f, 315.900000f, 319.800000f, 323.700000f,
+    327.600000f, 331.500000f, 335.400000f, 339.300000f, 343.200000f, 347.100000f, 351.000000f, 354.900000f,
+    358.800000f, 362.700000f, 366.600000f, 370.500000f, 374.400000f, 378.300000f, 382.200000f, 386.100000f,
+    390.000000f, 393.900000f, 397.800000f, 401.700000f, 405.600000f, 409.500000f, 413.400000f, 417.300000f,
+    421.200000f, 425.100000f, 429.000000f, 432.900000f, 436.800000f, 440.700000f, 444.600000f, 448.500000f,
+    452.400000f, 456.300000f, 460.200000f, 464.100000f, 468.000000f, 471.900000f, 475.800000f, 479.700000f,
+    483.600000f, 487.500000f, 491.400000f, 495.300000f, 499.200000f, 503.100000f, 507.000000f, 510.900000f,
+    514.800000f, 518.700000f, 522.600000f, 526.500000f, 530.400000f, 534.300000f, 538.200000f, 542.100000f,
+    0.000000f, 4.000000f, 8.000000f, 12.000000f, 16.000000f, 20.000000f, 24.000000f, 28.000000f,
+    32.000000f, 36.000000f, 40.000000f, 44.000000f, 48.000000f, 52.000000f, 56.000000f, 60.000000f,
+    64.000000f, 68.000000f, 72.000000f, 76.000000f, 80.000000f, 84.000000f, 88.000000f, 92.000000f,
+    96.000000f, 100.000000f, 104.000000f, 108.000000f, 112.000000f, 116.000000f, 120.000000f, 124.000000f,
+    128.000000f, 132.000000f, 136.000000f, 140.000000f, 144.000000f, 148.000000f, 152.000000f, 156.000000f,
+    160.000000f, 164.000000f, 168.000000f, 172.000000f, 176.000000f, 180.000000f, 184.000000f, 188.000000f,
+    192.000000f, 196.000000f, 200.000000f, 204.000000f, 208.000000f, 212.000000f, 216.000000f, 220.000000f,
+    224.000000f, 228.000000f, 232.000000f, 236.000000f, 240.000000f, 244.000000f, 248.000000f, 252.000000f,
+    256.000000f, 260.000000f, 264.000000f, 268.000000f, 272.000000f, 276.000000f, 280.000000f, 284.000000f,
+    288.000000f, 292.000000f, 296.000000f, 300.000000f, 304.000000f, 308.000000f, 312.000000f, 316.000000f,
+    320.000000f, 324.000000f, 328.000000f, 332.000000f, 336.000000f, 340.000000f, 344.000000f, 348.000000f,
+    352.000000f, 356.000000f, 360.000000f, 364.000000f, 368.000000f, 372.000000f, 376.000000f, 380.000000f,
+    384.000000f, 388.000000f, 392.000000f, 396.000000f, 400.000000f, 404.000000f, 408.000000f, 412.000000f,
+    416.000000f, 420.000000f, 424.000000f, 428.000000f, 432.000000f, 436.000000f, 440.000000f, 444.000000f,
+    448.000000f, 452.000000f, 456.000000f, 460.000000f, 464.000000f, 468.000000f, 472.000000f, 476.000000f,
+    480.000000f, 484.000000f, 488.000000f, 492.000000f, 496.000000f, 500.000000f, 504.000000f, 508.000000f,
+    512.000000f, 516.000000f, 520.000000f, 524.000000f, 528.000000f, 532.000000f, 536.000000f, 540.000000f,
+    544.000000f, 548.000000f, 552.000000f, 556.000000f, 0.000000f, 4.100000f, 8.200000f, 12.300000f,
+    16.400000f, 20.500000f, 24.600000f, 28.700000f, 32.800000f, 36.900000f, 41.000000f, 45.100000f,
+    49.200000f, 53.300000f, 57.400000f, 61.500000f, 65.600000f, 69.700000f, 73.800000f, 77.900000f,
+    82.000000f, 86.100000f, 90.200000f, 94.300000f, 98.400000f, 102.500000f, 106.600000f, 110.700000f,
+    114.800000f, 118.900000f, 123.000000f, 127.100000f, 131.200000f, 135.300000f, 139.400000f, 143.500000f,
+    147.600000f, 151.700000f, 155.800000f, 159.900000f, 164.000000f, 168.100000f, 172.200000f, 176.300000f,
+    180.400000f, 184.500000f, 188.600000f, 192.700000f, 196.800000f, 200.900000f, 205.000000f, 209.100000f,
+    213.200000f, 217.300000f, 221.400000f, 225.500000f, 229.600000f, 233.700000f, 237.800000f, 241.900000f,
+    246.000000f, 250.100000f, 254.200000f, 258.300000f, 262.400000f, 266.500000f, 270.600000f, 274.700000f,
+    278.800000f, 282.900000f, 287.000000f, 291.100000f, 295.200000f, 299.300000f, 303.400000f, 307.500000f,
+    311.600000f, 315.700000f, 319.800000f, 323.900000f, 328.000000f, 332.100000f, 336.200000f, 340.300000f,
+    344.400000f, 348.500000f, 352.600000f, 356.700000f, 360.800000f, 364.900000f, 369.000000f, 373.100000f,
+    377.200000f, 381.300000f, 385.400000f, 389.500000f, 393.600000f, 397.700000f, 401.800000f, 405.900000f,
+    410.000000f, 414.100000f, 418.200000f, 422.300000f, 426.400000f, 430.500000f, 434.600000f, 438.700000f,
+    442.800000f, 446.900000f, 451.000000f, 455.100000f, 459.200000f, 463.300000f, 467.400000f, 471.500000f,
+    475.600000f, 479.700000f, 483.800000f, 487.900000f, 492.000000f, 496.100000f, 500.200000f, 504.300000f,
+    508.400000f, 512.500000f, 516.600000f, 520.700000f, 524.800000f, 528.900000f, 533.000000f, 537.100000f,
+    541.200000f, 545.300000f, 549.400000f, 553.500000f, 557.600000f, 561.700000f, 565.800000f, 569.900000f,
+    0.000000f, 4.200000f, 8.400000f, 12.600000f, 16.800000f, 21.000000f, 25.200000f, 29.400000f,
+    33.600000f, 37.800000f, 42.000000f, 46.200000f, 50.400000f, 54.600000f, 58.800000f, 63.000000f,
+    67.200000f, 71.400000f, 75.600000f, 79.800000f, 84.000000f, 88.200000f, 92.400000f, 96.600000f,
+    100.800000f, 105.000000f, 109.200000f, 113.400000f, 117.600000f, 121.800000f, 126.000000f, 130.200000f,
+    134.400000f, 138.600000f, 142.800000f, 147.000000f, 151.200000f, 155.400000f, 159.600000f, 163.800000f,
+    168.000000f, 172.200000f, 176.400000f, 180.600000f, 184.800000f, 189.000000f, 193.200000f, 197.400000f,
+    201.600000f, 205.800000f, 210.000000f, 214.200000f, 218.400000f, 222.600000f, 226.800000f, 231.000000f,
+    235.200000f, 239.400000f, 243.600000f, 247.800000f, 252.000000f, 256.200000f, 260.400000f, 264.600000f,
+    268.800000f, 273.000000f, 277.200000f, 281.400000f, 285.600000f, 289.800000f, 294.000000f, 298.200000f,
+    302.400000f, 306.600000f, 310.800000f, 315.000000f, 319.200000f, 323.400000f, 327.600000f, 331.800000f,
+    336.000000f, 340.200000f, 344.400000f, 348.600000f, 352.800000f, 357.000000f, 361.200000f, 365.400000f,
+    369.600000f, 373.800000f, 378.000000f, 382.200000f, 386.400000f, 390.600000f, 394.800000f, 399.000000f,
+    403.200000f, 407.400000f, 411.600000f, 415.800000f, 420.000000f, 424.200000f, 428.400000f, 432.600000f,
+    436.800000f, 441.000000f, 445.200000f, 449.400000f, 453.600000f, 457.800000f, 462.000000f, 466.200000f,
+    470.400000f, 474.600000f, 478.800000f, 483.000000f, 487.200000f, 491.400000f, 495.600000f, 499.800000f,
+    504.000000f, 508.200000f, 512.400000f, 516.600000f, 520.800000f, 525.000000f, 529.200000f, 533.400000f,
+    537.600000f, 541.800000f, 546.000000f, 550.200000f, 554.400000f, 558.600000f, 562.800000f, 567.000000f,
+    571.200000f, 575.400000f, 579.600000f, 583.800000f, 0.000000f, 4.300000f, 8.600000f, 12.900000f,
+    17.200000f, 21.500000f, 25.800000f, 30.100000f, 34.400000f, 38.700000f, 43.000000f, 47.300000f,
+    51.600000f, 55.900000f, 60.200000f, 64.500000f, 68.800000f, 73.100000f, 77.400000f, 81.700000f,
+    86.000000f, 90.300000f, 94.600000f, 98.900000f, 103.200000f, 107.500000f, 111.800000f, 116.100000f,
+    120.400000f, 124.700000f, 129.000000f, 133.300000f, 137.600000f, 141.900000f, 146.200000f, 150.500000f,
+    154.800000f, 159.100000f, 163.400000f, 167.700000f, 172.000000f, 176.300000f, 180.600000f, 184.900000f,
+    189.200000f, 193.500000f, 197.800000f, 202.100000f, 206.400000f, 210.700000f, 215.000000f, 219.300000f,
+    223.600000f, 227.900000f, 232.200000f, 236.500000f, 240.800000f, 245.100000f, 249.400000f, 253.700000f,
+    258.000000f, 262.300000f, 266.600000f, 270.900000f, 275.200000f, 279.500000f, 283.800000f, 288.100000f,
+    292.400000f, 296.700000f, 301.000000f, 305.300000f, 309.600000f, 313.900000f, 318.200000f, 322.500000f,
+    326.800000f, 331.100000f, 335.400000f, 339.700000f, 344.000000f, 348.300000f, 352.600000f, 356.900000f,
+    361.200000f, 365.500000f, 369.800000f, 374.100000f, 378.400000f, 382.700000f, 387.000000f, 391.300000f,
+    395.600000f, 399.900000f, 404.200000f, 408.500000f, 412.800000f, 417.100000f, 421.400000f, 425.700000f,
+    430.000000f, 434.300000f, 438.600000f, 442.900000f, 447.200000f, 451.500000f, 455.800000f, 460.100000f,
+    464.400000f, 468.700000f, 473.000000f, 477.300000f, 481.600000f, 485.900000f, 490.200000f, 494.500000f,
+    498.800000f, 503.100000f, 507.400000f, 511.700000f, 516.000000f, 520.300000f, 524.600000f, 528.900000f,
+    533.200000f, 537.500000f, 541.800000f, 546.100000f, 550.400000f, 554.700000f, 559.000000f, 563.300000f,
+    567.600000f, 571.900000f, 576.200000f, 580.500000f, 584.800000f, 589.100000f, 593.400000f, 597.700000f,
+    0.000000f, 4.400000f, 8.800000f, 13.200000f, 17.600000f, 22.000000f, 26.400000f, 30.800000f,
+    35.200000f, 39.600000f, 44.000000f, 48.400000f, 52.800000f, 57.200000f, 61.600000f, 66.000000f,
+    70.400000f, 74.800000f, 79.200000f, 83.600000f, 88.000000f, 92.400000f, 96.800000f, 101.200000f,
+    105.600000f, 110.000000f, 114.400000f, 118.800000f, 123.200000f, 127.600000f, 132.000000f, 136.400000f,
+    140.800000f, 145.200000f, 149.600000f, 154.000000f, 158.400000f, 162.800000f, 167.200000f, 171.600000f,
+    176.000000f, 180.400000f, 184.800000f, 189.200000f, 193.600000f, 198.000000f, 202.400000f, 206.800000f,
+    211.200000f, 215.600000f, 220.000000f, 224.400000f, 228.800000f, 233.200000f, 237.600000f, 242.000000f,
+    246.400000f, 250.800000f, 255.200000f, 259.600000f, 264.000000f, 268.400000f, 272.800000f, 277.200000f,
+    281.600000f, 286.000000f, 290.400000f, 294.800000f, 299.200000f, 303.600000f, 308.000000f, 312.400000f,
+    316.800000f, 321.200000f, 325.600000f, 330.000000f, 334.400000f, 338.800000f, 343.200000f, 347.600000f,
+    352.000000f, 356.400000f, 360.800000f, 365.200000f, 369.600000f, 374.000000f, 378.400000f, 382.800000f,
+    387.200000f, 391.600000f, 396.000000f, 400.400000f, 404.800000f, 409.200000f, 413.600000f, 418.000000f,
+    422.400000f, 426.800000f, 431.200000f, 435.600000f, 440.000000f, 444.400000f, 448.800000f, 453.200000f,
+    457.600000f, 462.000000f, 466.400000f, 470.800000f, 475.200000f, 479.600000f, 484.000000f, 488.400000f,
+    492.800000f, 497.200000f, 501.600000f, 506.000000f, 510.400000f, 514.800000f, 519.200000f, 523.600000f,
+    528.000000f, 532.400000f, 536.800000f, 541.200000f, 545.600000f, 550.000000f, 554.400000f, 558.800000f,
+    563.200000f, 567.600000f, 572.000000f, 576.400000f, 580.800000f, 585.200000f, 589.600000f, 594.000000f,
+    598.400000f, 602.800000f, 607.200000f, 611.600000f, 0.000000f, 4.500000f, 9.000000f, 13.500000f,
+    18.000000f, 22.500000f, 27.000000f, 31.500000f, 36.000000f, 40.500000f, 45.000000f, 49.500000f,
+    54.000000f, 58.500000f, 63.000000f, 67.500000f, 72.000000f, 76.500000f, 81.000000f, 85.500000f,
+    90.000000f, 94.500000f, 99.000000f, 103.500000f, 108.000000f, 112.500000f, 117.000000f, 121.500000f,
+    126.000000f, 130.500000f, 135.000000f, 139.500000f, 144.000000f, 148.500000f, 153.000000f, 157.500000f,
+    162.000000f, 166.500000f, 171.000000f, 175.500000f, 180.000000f, 184.500000f, 189.000000f, 193.500000f,
+    198.000000f, 202.500000f, 207.000000f, 211.500000f, 216.000000f, 220.500000f, 225.000000f, 229.500000f,
+    234.000000f, 238.500000f, 243.000000f, 247.500000f, 252.000000f, 256.500000f, 261.000000f, 265.500000f,
+    270.000000f, 274.500000f, 279.000000f, 283.500000f, 288.000000f, 292.500000f, 297.000000f, 301.500000f,
+    306.000000f, 310.500000f, 315.000000f, 319.500000f, 324.000000f, 328.500000f, 333.000000f, 337.500000f,
+    342.000000f, 346.500000f, 351.000000f, 355.500000f, 360.000000f, 364.500000f, 369.000000f, 373.500000f,
+    378.000000f, 382.500000f, 387.000000f, 391.500000f, 396.000000f, 400.500000f, 405.000000f, 409.500000f,
+    414.000000f, 418.500000f, 423.000000f, 427.500000f, 432.000000f, 436.500000f, 441.000000f, 445.500000f,
+    450.000000f, 454.500000f, 459.000000f, 463.500000f, 468.000000f, 472.500000f, 477.000000f, 481.500000f,
+    486.000000f, 490.500000f, 495.000000f, 499.500000f, 504.000000f, 508.500000f, 513.000000f, 517.500000f,
+    522.000000f, 526.500000f, 531.000000f, 535.500000f, 540.000000f, 544.500000f, 549.000000f, 553.500000f,
+    558.000000f, 562.500000f, 567.000000f, 571.500000f, 576.000000f, 580.500000f, 585.000000f, 589.500000f,
+    594.000000f, 598.500000f, 603.000000f, 607.500000f, 612.000000f, 616.500000f, 621.000000f, 625.500000f,
+    0.000000f, 4.600000f, 9.200000f, 13.800000f, 18.400000f, 23.000000f, 27.600000f, 32.200000f,
+    36.800000f, 41.400000f, 46.000000f, 50.600000f, 55.200000f, 59.800000f, 64.400000f, 69.000000f,
+    73.600000f, 78.200000f, 82.800000f, 87.400000f, 92.000000f, 96.600000f, 101.200000f, 105.800000f,
+    110.400000f, 115.000000f, 119.600000f, 124.200000f, 128.800000f, 133.400000f, 138.000000f, 142.600000f,
+    147.200000f, 151.800000f, 156.400000f, 161.000000f, 165.600000f, 170.200000f, 174.800000f, 179.400000f,
+    184.000000f, 188.600000f, 193.200000f, 197.800000f, 202.400000f, 207.000000f, 211.600000f, 216.200000f,
+    220.800000f, 225.400000f, 230.000000f, 234.600000f, 239.200000f, 243.800000f, 248.400000f, 253.000000f,
+    257.600000f, 262.200000f, 266.800000f, 271.400000f, 276.000000f, 280.600000f, 285.200000f, 289.800000f,
+    294.400000f, 299.000000f, 303.600000f, 308.200000f, 312.800000f, 317.400000f, 322.000000f, 326.600000f,
+    331.200000f, 335.800000f, 340.400000f, 345.000000f, 349.600000f, 354.200000f, 358.800000f, 363.400000f,
+    368.000000f, 372.600000f, 377.200000f, 381.800000f, 386.400000f, 391.000000f, 395.600000f, 400.200000f,
+    404.800000f, 409.400000f, 414.000000f, 418.600000f, 423.200000f, 427.800000f, 432.400000f, 437.000000f,
+    441.600000f, 446.200000f, 450.800000f, 455.400000f, 460.000000f, 464.600000f, 469.200000f, 473.800000f,
+    478.400000f, 483.000000f, 487.600000f, 492.200000f, 496.800000f, 501.400000f, 506.000000f, 510.600000f,
+    515.200000f, 519.800000f, 524.400000f, 529.000000f, 533.600000f, 538.200000f, 542.800000f, 547.400000f,
+    552.000000f, 556.600000f, 561.200000f, 565.800000f, 570.400000f, 575.000000f, 579.600000f, 584.200000f,
+    588.800000f, 593.400000f, 598.000000f, 602.600000f, 607.200000f, 611.800000f, 616.400000f, 621.000000f,
+    625.600000f, 630.200000f, 634.800000f, 639.400000f, 0.000000f, 4.700000f, 9.400000f, 14.100000f,
+    18.800000f, 23.500000f, 28.200000f, 32.900000f, 37.600000f, 42.300000f, 47.000000f, 51.700000f,
+    56.400000f, 61.100000f, 65.800000f, 70.500000f, 75.200000f, 79.900000f, 84.600000f, 89.300000f,
+    94.000000f, 98.700000f, 103.400000f, 108.100000f, 112.800000f, 117.500000f, 122.200000f, 126.900000f,
+    131.600000f, 136.300000f, 141.000000f, 145.700000f, 150.400000f, 155.100000f, 159.800000f, 164.500000f,
+    169.200000f, 173.900000f, 178.600000f, 183.300000f, 188.000000f, 192.700000f, 197.400000f, 202.100000f,
+    206.800000f, 211.500000f, 216.200000f, 220.900000f, 225.600000f, 230.300000f, 235.000000f, 239.700000f,
+    244.400000f, 249.100000f, 253.800000f, 258.500000f, 263.200000f, 267.900000f, 272.600000f, 277.300000f,
+    282.000000f, 286.700000f, 291.400000f, 296.100000f, 300.800000f, 305.500000f, 310.200000f, 314.900000f,
+    319.600000f, 324.300000f, 329.000000f, 333.700000f, 338.400000f, 343.100000f, 347.800000f, 352.500000f,
+    357.200000f, 361.900000f, 366.600000f, 371.300000f, 376.000000f, 380.700000f, 385.400000f, 390.100000f,
+    394.800000f, 399.500000f, 404.200000f, 408.900000f, 413.600000f, 418.300000f, 423.000000f, 427.700000f,
+    432.400000f, 437.100000f, 441.800000f, 446.500000f, 451.200000f, 455.900000f, 460.600000f, 465.300000f,
+    470.000000f, 474.700000f, 479.400000f, 484.100000f, 488.800000f, 493.500000f, 498.200000f, 502.900000f,
+    507.600000f, 512.300000f, 517.000000f, 521.700000f, 526.400000f, 531.100000f, 535.800000f, 540.500000f,
+    545.200000f, 549.900000f, 554.600000f, 559.300000f, 564.000000f, 568.700000f, 573.400000f, 578.100000f,
+    582.800000f, 587.500000f, 592.200000f, 596.900000f, 601.600000f, 606.300000f, 611.000000f, 615.700000f,
+    620.400000f, 625.100000f, 629.800000f, 634.500000f, 639.200000f, 643.900000f, 648.600000f, 653.300000f,
+    0.000000f, 4.800000f, 9.600000f, 14.400000f, 19.200000f, 24.000000f, 28.800000f, 33.600000f,
+    38.400000f, 43.200000f, 48.000000f, 52.800000f, 57.600000f, 62.400000f, 67.200000f, 72.000000f,
+    76.800000f, 81.600000f, 86.400000f, 91.200000f, 96.000000f, 100.800000f, 105.600000f, 110.400000f,
+    115.200000f, 120.000000f, 124.800000f, 129.600000f, 134.400000f, 139.200000f, 144.000000f, 148.800000f,
+    153.600000f, 158.400000f, 163.200000f, 168.000000f, 172.800000f, 177.600000f, 182.400000f, 187.200000f,
+    192.000000f, 196.800000f, 201.600000f, 206.400000f, 211.200000f, 216.000000f, 220.800000f, 225.600000f,
+    230.400000f, 235.200000f, 240.000000f, 244.800000f, 249.600000f, 254.400000f, 259.200000f, 264.000000f,
+    268.800000f, 273.600000f, 278.400000f, 283.200000f, 288.000000f, 292.800000f, 297.600000f, 302.400000f,
+    307.200000f, 312.000000f, 316.800000f, 321.600000f, 326.400000f, 331.200000f, 336.000000f, 340.800000f,
+    345.600000f, 350.400000f, 355.200000f, 360.000000f, 364.800000f, 369.600000f, 374.400000f, 379.200000f,
+    384.000000f, 388.800000f, 393.600000f, 398.400000f, 403.200000f, 408.000000f, 412.800000f, 417.600000f,
+    422.400000f, 427.200000f, 432.000000f, 436.800000f, 441.600000f, 446.400000f, 451.200000f, 456.000000f,
+    460.800000f, 465.600000f, 470.400000f, 475.200000f, 480.000000f, 484.800000f, 489.600000f, 494.400000f,
+    499.200000f, 504.000000f, 508.800000f, 513.600000f, 518.400000f, 523.200000f, 528.000000f, 532.800000f,
+    537.600000f, 542.400000f, 547.200000f, 552.000000f, 556.800000f, 561.600000f, 566.400000f, 571.200000f,
+    576.000000f, 580.800000f, 585.600000f, 590.400000f, 595.200000f, 600.000000f, 604.800000f, 609.600000f,
+    614.400000f, 619.200000f, 624.000000f, 628.800000f, 633.600000f, 638.400000f, 643.200000f, 648.000000f,
+    652.800000f, 657.600000f, 662.400000f, 667.200000f, 0.000000f, 4.900000f, 9.800000f, 14.700000f,
+    19.600000f, 24.500000f, 29.400000f, 34.300000f, 39.200000f, 44.100000f, 49.000000f, 53.900000f,
+    58.800000f, 63.700000f, 68.600000f, 73.500000f, 78.400000f, 83.300000f, 88.200000f, 93.100000f,
+    98.000000f, 102.900000f, 107.800000f, 112.700000f, 117.600000f, 122.500000f, 127.400000f, 132.300000f,
+    137.200000f, 142.100000f, 147.000000f, 151.900000f, 156.800000f, 161.700000f, 166.600000f, 171.500000f,
+    176.400000f, 181.300000f, 186.200000f, 191.100000f, 196.000000f, 200.900000f, 205.800000f, 210.700000f,
+    215.600000f, 220.500000f, 225.400000f, 230.300000f, 235.200000f, 240.100000f, 245.000000f, 249.900000f,
+    254.800000f, 259.700000f, 264.600000f, 269.500000f, 274.400000f, 279.300000f, 284.200000f, 289.100000f,
+    294.000000f, 298.900000f, 303.800000f, 308.700000f, 313.600000f, 318.500000f, 323.400000f, 328.300000f,
+    333.200000f, 338.100000f, 343.000000f, 347.900000f, 352.800000f, 357.700000f, 362.600000f, 367.500000f,
+    372.400000f, 377.300000f, 382.200000f, 387.100000f, 392.000000f, 396.900000f, 401.800000f, 406.700000f,
+    411.600000f, 416.500000f, 421.400000f, 426.300000f, 431.200000f, 436.100000f, 441.000000f, 445.900000f,
+    450.800000f, 455.700000f, 460.600000f, 465.500000f, 470.400000f, 475.300000f, 480.200000f, 485.100000f,
+    490.000000f, 494.900000f, 499.800000f, 504.700000f, 509.600000f, 514.500000f, 519.400000f, 524.300000f,
+    529.200000f, 534.100000f, 539.000000f, 543.900000f, 548.800000f, 553.700000f, 558.600000f, 563.500000f,
+    568.400000f, 573.300000f, 578.200000f, 583.100000f, 588.000000f, 592.900000f, 597.800000f, 602.700000f,
+    607.600000f, 612.500000f, 617.400000f, 622.300000f, 627.200000f, 632.100000f, 637.000000f, 641.900000f,
+    646.800000f, 651.700000f, 656.600000f, 661.500000f, 666.400000f, 671.300000f, 676.200000f, 681.100000f
+};
+
+// Squared norm of each support vector
+alignas(16) const float supportVectorSqNorms[SVM_NUM_SUPPORT_VECTORS] = {
+    0.000000f, 9048.900000f, 36195.600000f, 81440.100000f, 144782.400000f, 226222.500000f, 325760.400000f, 443396.100000f,
+    579129.600000f, 732960.900000f, 904890.000000f, 1094916.900000f, 1303041.600000f, 1529264.100000f, 1773584.400000f, 2036002.500000f,
+    2316518.400000f, 2615132.100000f, 2931843.600000f, 3266652.900000f, 3619560.000000f, 3990564.900000f, 4379667.600000f, 4786868.100000f,
+    5212166.400000f, 5655562.500000f, 6117056.400000f, 6596648.100000f, 7094337.600000f, 7610124.900000f, 8144010.000000f, 8695992.900000f,
+    9266073.600000f, 9854252.100000f, 10460528.400000f, 11084902.500000f, 11727374.400000f, 12387944.100000f, 13066611.600000f, 13763376.900000f,
+    14478240.000000f, 15211200.900000f, 15962259.600000f, 16731416.100000f, 17518670.400000f, 18324022.500000f, 19147472.400000f, 19989020.100000f,
+    20848665.600000f, 21726408.900000f
+};
+
+// Cascade bounds: sums of the positive / negative coefficients from support vector i on
+alignas(16) const float svmRemainingPositive[SVM_NUM_SUPPORT_VECTORS + 1] = {
+    25.000000f, 24.000000f, 24.000000f, 23.000000f, 23.000000f, 22.000000f, 22.000000f, 21.000000f,
+    21.000000f, 20.000000f, 20.000000f, 19.000000f, 19.000000f, 18.000000f, 18.000000f, 17.000000f,
+    17.000000f, 16.000000f, 16.000000f, 15.000000f, 15.000000f, 14.000000f, 14.000000f, 13.000000f,
+    13.000000f, 12.000000f, 12.000000f, 11.000000f, 11.000000f, 10.000000f, 10.000000f, 9.000000f,
+    9.000000f, 8.000000f, 8.000000f, 7.000000f, 7.000000f, 6.000000f, 6.000000f, 5.000000f,
+    5.000000f, 4.000000f, 4.000000f, 3.000000f, 3.000000f, 2.000000f, 2.000000f, 1.000000f,
+    1.000000f, 0.000000f, 0.000000f
+};
+
+alignas(16) const float svmRemainingNegative[SVM_NUM_SUPPORT_VECTORS + 1] = {
+    -25.000000f, -25.000000f, -24.000000f, -24.000000f, -23.000000f, -23.000000f, -22.000000f, -22.000000f,
+    -21.000000f, -21.000000f, -20.000000f, -20.000000f, -19.000000f, -19.000000f, -18.000000f, -18.000000f,
+    -17.000000f, -17.000000f, -16.000000f, -16.000000f, -15.000000f, -15.000000f, -14.000000f, -14.000000f,
+    -13.000000f, -13.000000f, -12.000000f, -12.000000f, -11.000000f, -11.000000f, -10.000000f, -10.000000f,
+    -9.000000f, -9.000000f, -8.000000f, -8.000000f, -7.000000f, -7.000000f, -6.000000f, -6.000000f,
+    -5.000000f, -5.000000f, -4.000000f, -4.000000f, -3.000000f, -3.000000f, -2.000000f, -2.000000f,
+    -1.000000f, -1.000000f, 0.000000f
+};
+
+// Linear pre-filter: windows scoring above SVM_PREFILTER_THRESHOLD are normal
+alignas(16) const float svmPrefilterWeights[SVM_NUM_FEATURES] = {
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f
+};